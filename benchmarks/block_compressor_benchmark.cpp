@@ -0,0 +1,102 @@
+#include "ramrod/gl/block_compressor.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+  // Heat map like image: smooth gradients, a few hard edges and some noise
+  std::vector<std::uint8_t> generate(const GLsizei width, const GLsizei height){
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) * height * 4);
+    std::uint32_t seed{12345};
+    for(GLsizei y = 0; y < height; ++y){
+      for(GLsizei x = 0; x < width; ++x){
+        seed = seed * 1664525u + 1013904223u;
+        const int noise{static_cast<int>(seed >> 28) - 8};
+        const double value{0.5 + 0.5 * std::sin(x * 0.013) * std::cos(y * 0.021)};
+        const bool cell{((x / 97) + (y / 61)) % 5 == 0};
+        std::uint8_t *pixel{&pixels[(static_cast<std::size_t>(y) * width + x) * 4]};
+        const int red{static_cast<int>(value * 255.0) + noise};
+        pixel[0] = static_cast<std::uint8_t>(red < 0 ? 0 : red > 255 ? 255 : red);
+        pixel[1] = static_cast<std::uint8_t>(cell ? 255 - pixel[0] : (x * 255) / width);
+        pixel[2] = static_cast<std::uint8_t>((y * 255) / height);
+        pixel[3] = static_cast<std::uint8_t>(cell ? 128 : 255);
+      }
+    }
+    return pixels;
+  }
+
+  const char *format_name(const ramrod::gl::compression::format format){
+    switch(format){
+      case ramrod::gl::compression::format::bc1: return "BC1";
+      case ramrod::gl::compression::format::bc4: return "BC4";
+      case ramrod::gl::compression::format::bc5: return "BC5";
+      case ramrod::gl::compression::format::bc7: return "BC7";
+    }
+    return "";
+  }
+
+  const char *quality_name(const ramrod::gl::compression::quality quality){
+    switch(quality){
+      case ramrod::gl::compression::quality::fast: return "fast";
+      case ramrod::gl::compression::quality::normal: return "normal";
+      case ramrod::gl::compression::quality::high: return "high";
+    }
+    return "";
+  }
+}
+
+/**
+ * Usage: ramrod_gl_block_compressor_benchmark [size] [threads]
+ *
+ * Compresses a size x size RGBA image with every format and quality, printing the
+ * throughput and the PSNR of the channels stored by the format.
+ */
+int main(int argc, char *argv[]){
+  using namespace ramrod::gl;
+
+  const GLsizei size{argc > 1 ? std::atoi(argv[1]) : 2048};
+  const unsigned int threads{argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 0};
+  if(size <= 0){
+    std::fprintf(stderr, "Invalid size\n");
+    return 1;
+  }
+
+  const std::vector<std::uint8_t> pixels{generate(size, size)};
+  const double megapixels{static_cast<double>(size) * size / 1e6};
+
+  std::printf("%dx%d RGBA, %u threads\n", size, size,
+              threads > 0 ? threads : std::thread::hardware_concurrency());
+  std::printf("%-6s %-8s %12s %10s\n", "format", "quality", "MPixels/s", "PSNR dB");
+
+  for(const compression::format format : {compression::format::bc1, compression::format::bc4,
+                                           compression::format::bc5, compression::format::bc7}){
+    for(const compression::quality quality : {compression::quality::fast,
+                                              compression::quality::normal,
+                                              compression::quality::high}){
+      block_compressor compressor(format, quality, threads);
+      std::vector<std::uint8_t> blocks(compressor.compressed_size(size, size));
+
+      // one warm up run starts the threads and touches the output
+      compressor.compress(pixels.data(), size, size, 4, blocks.data());
+      int runs{0};
+      const auto start{std::chrono::steady_clock::now()};
+      auto elapsed{std::chrono::steady_clock::duration::zero()};
+      do{
+        compressor.compress(pixels.data(), size, size, 4, blocks.data());
+        ++runs;
+        elapsed = std::chrono::steady_clock::now() - start;
+      }while(runs < 3 || elapsed < std::chrono::milliseconds(500));
+
+      const double seconds{std::chrono::duration<double>(elapsed).count()};
+      std::printf("%-6s %-8s %12.1f %10.2f\n", format_name(format), quality_name(quality),
+                  megapixels * runs / seconds,
+                  compressor.psnr(pixels.data(), size, size, 4, blocks.data()));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,129 @@
+#include "ramrod/gl/context.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace {
+  struct result {
+    std::size_t frames{0};
+    double seconds{0.0};
+    bool created{false};
+  };
+
+  // Clears and reads back a frame buffer in its own context until `stop` is set
+  void render(const GLsizei size, std::atomic<int> &ready, const std::atomic<bool> &go,
+              const std::atomic<bool> &stop, result &output){
+    ramrod::gl::context headless;
+    if(!headless.create() || !headless.make_current()){
+      ++ready;
+      return;
+    }
+
+    GLuint frame_buffer{0}, render_buffer{0};
+    glGenFramebuffers(1, &frame_buffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer);
+    glGenRenderbuffers(1, &render_buffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, render_buffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size, size);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                              render_buffer);
+    glViewport(0, 0, size, size);
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(size) * size * 4);
+
+    // one warm up frame compiles the driver's clear and read paths
+    glClear(GL_COLOR_BUFFER_BIT);
+    glReadPixels(0, 0, size, size, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    output.created = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    ++ready;
+    while(!go) std::this_thread::yield();
+
+    const auto start{std::chrono::steady_clock::now()};
+    std::size_t frames{0};
+    while(!stop){
+      glClearColor(static_cast<GLfloat>(frames % 256) / 255.0f, 0.5f, 0.25f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT);
+      glReadPixels(0, 0, size, size, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+      ++frames;
+    }
+    output.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                                   - start).count();
+    output.frames = frames;
+
+    glDeleteRenderbuffers(1, &render_buffer);
+    glDeleteFramebuffers(1, &frame_buffer);
+  }
+
+  // Frames per second of all the contexts together, 0 if a context could not be created
+  double run(const unsigned int contexts, const GLsizei size, const int milliseconds){
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false}, stop{false};
+    std::vector<result> results(contexts);
+    std::vector<std::thread> threads;
+    for(unsigned int i = 0; i < contexts; ++i)
+      threads.emplace_back(render, size, std::ref(ready), std::cref(go), std::cref(stop),
+                           std::ref(results[i]));
+
+    while(ready < static_cast<int>(contexts)) std::this_thread::yield();
+    go = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    stop = true;
+    for(std::thread &thread : threads)
+      thread.join();
+
+    double rate{0.0};
+    for(const result &output : results){
+      if(!output.created || output.seconds <= 0.0) return 0.0;
+      rate += static_cast<double>(output.frames) / output.seconds;
+    }
+    return rate;
+  }
+}
+
+/**
+ * Usage: ramrod_gl_multi_context_benchmark [size] [contexts] [milliseconds]
+ *
+ * Clears and reads back a size x size frame buffer in 1, 2, 4... up to `contexts`
+ * headless contexts, one thread each, and prints the frames per second of all of them
+ * together and the scaling against one context.
+ */
+int main(int argc, char *argv[]){
+  const GLsizei size{argc > 1 ? std::atoi(argv[1]) : 256};
+  const int maximum{argc > 2 ? std::atoi(argv[2]) : 4};
+  const int milliseconds{argc > 3 ? std::atoi(argv[3]) : 1000};
+  if(size <= 0 || maximum <= 0 || milliseconds <= 0){
+    std::printf("Invalid arguments\n");
+    return EXIT_FAILURE;
+  }
+
+#ifdef GLAD_THREAD_LOCAL
+  const char *glad{"thread-local"};
+#else
+  const char *glad{"shared"};
+#endif
+  std::printf("%dx%d RGBA8 clear and read back, %u hardware threads, %s GLAD pointers\n",
+              size, size, std::thread::hardware_concurrency(), glad);
+  std::printf("%8s %12s %12s %8s\n", "contexts", "frames/s", "per context", "scaling");
+
+  std::vector<unsigned int> counts;
+  for(unsigned int contexts = 1; contexts < static_cast<unsigned int>(maximum); contexts *= 2)
+    counts.push_back(contexts);
+  counts.push_back(static_cast<unsigned int>(maximum));
+
+  double single{0.0};
+  for(const unsigned int contexts : counts){
+    const double rate{run(contexts, size, milliseconds)};
+    if(rate <= 0.0){
+      std::printf("No headless OpenGL context\n");
+      return EXIT_FAILURE;
+    }
+    if(single == 0.0) single = rate;
+    std::printf("%8u %12.0f %12.0f %7.2fx\n", contexts, rate, rate / contexts, rate / single);
+  }
+  return 0;
+}
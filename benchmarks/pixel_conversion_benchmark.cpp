@@ -0,0 +1,95 @@
+#include "ramrod/gl/pixel_conversion.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace {
+  // Runs a conversion for at least 200 ms and returns the pixels converted per second
+  double measure(const std::function<void()> &conversion, const std::size_t pixels){
+    conversion();
+    int runs{0};
+    const auto start{std::chrono::steady_clock::now()};
+    auto elapsed{std::chrono::steady_clock::duration::zero()};
+    do{
+      conversion();
+      ++runs;
+      elapsed = std::chrono::steady_clock::now() - start;
+    }while(runs < 3 || elapsed < std::chrono::milliseconds(200));
+    return static_cast<double>(pixels) * runs / std::chrono::duration<double>(elapsed).count();
+  }
+
+  const char *simd_name(const ramrod::gl::pixel::simd set){
+    switch(set){
+      case ramrod::gl::pixel::simd::scalar: return "scalar";
+      case ramrod::gl::pixel::simd::sse2: return "sse2";
+      case ramrod::gl::pixel::simd::avx2: return "avx2";
+    }
+    return "";
+  }
+}
+
+/**
+ * Usage: ramrod_gl_pixel_conversion_benchmark [width] [height]
+ *
+ * Runs every conversion with every instruction set supported by the processor and
+ * prints the throughput in MPixels/s.
+ */
+int main(int argc, char *argv[]){
+  using namespace ramrod::gl;
+
+  const std::size_t width{argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 1920};
+  const std::size_t height{argc > 2 ? static_cast<std::size_t>(std::atol(argv[2])) : 1080};
+  if(width == 0 || height == 0){
+    std::fprintf(stderr, "Invalid size\n");
+    return 1;
+  }
+
+  const std::size_t pixels{width * height};
+  std::vector<std::uint8_t> rgb(pixels * 3), rgba(pixels * 4), other(pixels * 4);
+  std::vector<float> linear(pixels * 4);
+  std::vector<std::uint16_t> half(pixels * 4);
+  std::vector<std::uint8_t> y(pixels), uv(pixels);
+  for(std::size_t i = 0; i < rgba.size(); ++i)
+    rgba[i] = static_cast<std::uint8_t>(i * 7 + i / 4093);
+  for(std::size_t i = 0; i < rgb.size(); ++i)
+    rgb[i] = static_cast<std::uint8_t>(i * 13);
+  for(std::size_t i = 0; i < linear.size(); ++i)
+    linear[i] = static_cast<float>(i % 1000) / 999.0f;
+
+  const struct {
+    const char *name;
+    std::function<void()> conversion;
+  } conversions[]{
+    {"rgb_to_rgba", [&]{ pixel::rgb_to_rgba(rgb.data(), other.data(), pixels); }},
+    {"rgba_to_rgb", [&]{ pixel::rgba_to_rgb(rgba.data(), rgb.data(), pixels); }},
+    {"swap_red_blue", [&]{ pixel::swap_red_blue(rgba.data(), other.data(), pixels); }},
+    {"flip_vertically", [&]{ pixel::flip_vertically(other.data(), width * 4, height); }},
+    {"to_srgb", [&]{ pixel::to_srgb(linear.data(), other.data(), pixels * 4); }},
+    {"from_srgb", [&]{ pixel::from_srgb(rgba.data(), linear.data(), pixels * 4); }},
+    {"to_half", [&]{ pixel::to_half(linear.data(), half.data(), pixels * 4); }},
+    {"from_half", [&]{ pixel::from_half(half.data(), linear.data(), pixels * 4); }},
+    {"bgra_to_nv12", [&]{ pixel::bgra_to_nv12(rgba.data(), width * 4, width, height,
+                                              y.data(), uv.data()); }}
+  };
+
+  const pixel::simd best{pixel::instruction_set()};
+  std::printf("%zux%zu pixels, MPixels/s\n%-16s", width, height, "conversion");
+  for(unsigned int set = 0; set <= static_cast<unsigned int>(best); ++set)
+    std::printf(" %10s", simd_name(static_cast<pixel::simd>(set)));
+  std::printf("\n");
+
+  for(const auto &item : conversions){
+    std::printf("%-16s", item.name);
+    for(unsigned int set = 0; set <= static_cast<unsigned int>(best); ++set){
+      pixel::instruction_set(static_cast<pixel::simd>(set));
+      std::printf(" %10.1f", measure(item.conversion, pixels) / 1e6);
+    }
+    std::printf("\n");
+    pixel::instruction_set(best);
+  }
+  return 0;
+}
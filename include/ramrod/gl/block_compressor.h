@@ -0,0 +1,168 @@
+#ifndef RAMROD_GL_BLOCK_COMPRESSOR_H
+#define RAMROD_GL_BLOCK_COMPRESSOR_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/enumerators.h"
+
+#include <cstddef>
+#include <vector>
+
+// GL_EXT_texture_compression_s3tc is not part of the core profile loader
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
+namespace ramrod {
+  namespace gl {
+    class texture;
+
+    class block_compressor
+    {
+    public:
+      /**
+       * @brief Creates a CPU block compression encoder
+       *
+       * @param format  Specifies the block format: BC1 (RGB), BC4 (R), BC5 (RG) or BC7
+       *                (RGBA, mode 6 only).
+       * @param quality Specifies the speed/quality trade-off used when searching endpoints.
+       * @param threads Specifies the number of worker threads, 0 uses all hardware threads.
+       */
+      block_compressor(const compression::format format = compression::format::bc1,
+                       const compression::quality quality = compression::quality::normal,
+                       const unsigned int threads = 0);
+      /**
+       * @brief Getting the size in bytes of a single 4x4 block
+       *
+       * @return 8 for BC1 and BC4, 16 for BC5 and BC7
+       */
+      std::size_t block_size() const;
+      /**
+       * @brief Compresses an 8 bits per channel image into 4x4 blocks
+       *
+       * Images whose size is not a multiple of 4 are padded by replicating their edge
+       * pixels. Channels missing from the input are read as 0 for green and blue and as
+       * 255 for alpha, like OpenGL does.
+       *
+       * @param pixels     Specifies a pointer to tightly packed, top-to-bottom pixel rows.
+       * @param width      Specifies the width of the image in pixels.
+       * @param height     Specifies the height of the image in pixels.
+       * @param components Specifies the number of 8 bits channels per pixel (1 to 4).
+       * @param output     Specifies where the blocks are written, it must be at least
+       *                   `compressed_size(width, height)` bytes long.
+       *
+       * @return `false` if any parameter is invalid
+       */
+      bool compress(const void *pixels, const GLsizei width, const GLsizei height,
+                    const int components, void *output) const;
+      /**
+       * @brief Getting the size in bytes of a compressed image
+       *
+       * @param width  Specifies the width of the image in pixels.
+       * @param height Specifies the height of the image in pixels.
+       *
+       * @return Size in bytes of all the blocks covering the image
+       */
+      std::size_t compressed_size(const GLsizei width, const GLsizei height) const;
+      /**
+       * @brief Decodes blocks generated by this encoder into RGBA pixels
+       *
+       * Only the BC7 mode 6 is decoded, other BC7 modes are returned as transparent black.
+       *
+       * @param blocks Specifies a pointer to the compressed blocks.
+       * @param width  Specifies the width of the image in pixels.
+       * @param height Specifies the height of the image in pixels.
+       * @param rgba   Specifies where the decoded pixels are written, it must be at least
+       *               `width * height * 4` bytes long.
+       *
+       * @return `false` if any parameter is invalid
+       */
+      bool decompress(const void *blocks, const GLsizei width, const GLsizei height,
+                      void *rgba) const;
+      /**
+       * @brief Getting the block format
+       *
+       * @return Current block format
+       */
+      compression::format format() const;
+      /**
+       * @brief Setting the block format
+       *
+       * @param new_format Specifies the new block format
+       */
+      void format(const compression::format new_format);
+      /**
+       * @brief Getting the OpenGL internal format that matches the block format
+       *
+       * @return GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RED_RGTC1,
+       *         GL_COMPRESSED_RG_RGTC2 or GL_COMPRESSED_RGBA_BPTC_UNORM
+       */
+      GLenum internal_format() const;
+      /**
+       * @brief Measuring the peak signal-to-noise ratio of a compressed image
+       *
+       * Only the channels stored by the block format are compared.
+       *
+       * @param pixels     Specifies the original image given to `compress()`.
+       * @param width      Specifies the width of the image in pixels.
+       * @param height     Specifies the height of the image in pixels.
+       * @param components Specifies the number of 8 bits channels per pixel (1 to 4).
+       * @param blocks     Specifies the compressed blocks.
+       *
+       * @return PSNR in decibels, infinity for a lossless result or -1 if error happened
+       */
+      double psnr(const void *pixels, const GLsizei width, const GLsizei height,
+                  const int components, const void *blocks) const;
+      /**
+       * @brief Getting the encoding quality
+       *
+       * @return Current encoding quality
+       */
+      compression::quality quality() const;
+      /**
+       * @brief Setting the encoding quality
+       *
+       * @param new_quality `fast` uses bounding boxes, `normal` uses principal axes and
+       *                    `high` additionally refines the endpoints by least squares
+       */
+      void quality(const compression::quality new_quality);
+      /**
+       * @brief Getting the number of worker threads
+       *
+       * @return Number of threads used by `compress()`
+       */
+      unsigned int threads() const;
+      /**
+       * @brief Setting the number of worker threads
+       *
+       * @param new_threads Specifies the number of threads, 0 uses all hardware threads.
+       */
+      void threads(const unsigned int new_threads);
+      /**
+       * @brief Compresses an image and uploads it into a texture
+       *
+       * The texture must be bound, the compressed image is kept in an internal buffer
+       * which is reused between calls.
+       *
+       * @param target     Specifies the texture which will receive the image.
+       * @param pixels     Specifies a pointer to tightly packed, top-to-bottom pixel rows.
+       * @param width      Specifies the width of the image in pixels.
+       * @param height     Specifies the height of the image in pixels.
+       * @param components Specifies the number of 8 bits channels per pixel (1 to 4).
+       * @param level      Specifies the level-of-detail number.
+       *
+       * @return `false` if the texture has not been generated or the parameters are invalid
+       */
+      bool upload(texture &target, const void *pixels, const GLsizei width,
+                  const GLsizei height, const int components, const GLint level = 0);
+
+    private:
+      compression::format format_;
+      compression::quality quality_;
+      unsigned int threads_;
+      std::vector<unsigned char> scratch_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_BLOCK_COMPRESSOR_H
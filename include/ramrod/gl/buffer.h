@@ -2,6 +2,7 @@
 #define RAMROD_GL_BUFFER_H
 
 #include "glad/glad.h"
+#include "ramrod/gl/sync.h"
 
 namespace ramrod {
   namespace gl {
@@ -251,6 +252,23 @@ namespace ramrod {
        * @returns `GL_VERTEX_ARRAY_OBJECT`'s ID
        */
       GLuint id_vertex();
+      /**
+       * @brief Maps the `GL_ARRAY_BUFFER` once the GPU finished with it, instead of
+       *        blocking inside the driver
+       *
+       * This function additionally binds the `GL_ARRAY_BUFFER`, release the mapping
+       * with `unmap_array()`.
+       *
+       * @param ready   Specifies the fence inserted after the commands using the buffer
+       * @param access  Specifies a combination of access flags, as in `glMapBufferRange`
+       * @param timeout Specifies the nanoseconds to wait for the fence, 0 only polls
+       *
+       * @returns Pointer to the `size_in_bytes` given to `allocate_array()`, or `nullptr`
+       *          if the fence is not signaled yet, waiting failed or `generate_array()`
+       *          has not been called
+       */
+      void *map_array_when_ready(sync &ready, const GLenum access = GL_MAP_READ_BIT,
+                                 const GLuint64 timeout = 0);
       /**
        * @brief Getting the size in bytes of the `GL_ARRAY_BUFFER`
        *
@@ -267,6 +285,15 @@ namespace ramrod {
        * @returns Size in bytes of `GL_ELEMENT_ARRAY_BUFFER`
        */
       GLint size_element();
+      /**
+       * @brief Releases the mapping of `map_array_when_ready()`
+       *
+       * This function additionally binds the `GL_ARRAY_BUFFER`
+       *
+       * @returns `false` if the data store became corrupt while mapped or
+       *          `generate_array()` has not been called
+       */
+      bool unmap_array();
       /**
        * @brief Binds this `GL_VERTEX_ARRAY_OBJECT`
        *
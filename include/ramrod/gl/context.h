@@ -0,0 +1,105 @@
+#ifndef RAMROD_GL_CONTEXT_H
+#define RAMROD_GL_CONTEXT_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/enumerators.h"
+#include "ramrod/gl/texture_units.h"
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief OpenGL context without window, for offscreen rendering
+     *
+     * Created with surfaceless EGL (Mesa llvmpipe on servers without GPU) or with OSMesa
+     * when the library is built with it. There is no default frame buffer, draw into
+     * `frame_buffer` objects.
+     *
+     * GLAD is loaded when a context is made current. With `RAMROD_GL_THREAD_LOCAL_GLAD`
+     * every thread has its own function pointers, so threads can drive contexts of
+     * different backends at the same time; otherwise all the contexts of the process
+     * must come from the same backend.
+     *
+     * Every context has its own `texture_units` table which becomes the current one of
+     * the thread calling `make_current()`. A context is current in one thread at a time,
+     * so a worker thread per context scales the rendering across processor cores.
+     */
+    class context
+    {
+    public:
+      context();
+      ~context();
+      /**
+       * @brief Getting the library used to create this context
+       *
+       * @return The backend or `headless::backend::none` if not created
+       */
+      headless::backend backend() const;
+      /**
+       * @brief Creates a core profile context
+       *
+       * @param major   Specifies the major OpenGL version
+       * @param minor   Specifies the minor OpenGL version
+       * @param backend Specifies the library, `automatic` tries EGL first then OSMesa
+       * @param shared  Specifies a context sharing its objects with this one, it can be
+       *                `nullptr`; this context then uses the same backend
+       *
+       * @return `false` if it was already created or no backend could create it
+       */
+      bool create(const int major = 4, const int minor = 2,
+                  headless::backend backend = headless::backend::automatic,
+                  context *shared = nullptr);
+      /**
+       * @brief Destroys the context, releasing it first if current in this thread
+       *
+       * @return `false` if it was not created
+       */
+      bool destroy();
+      /**
+       * @brief Checking if the context was created
+       *
+       * @return `true` if `create()` succeeded
+       */
+      bool is_created() const;
+      /**
+       * @brief Makes this context current in the calling thread
+       *
+       * Loads GLAD the first time and selects this context's `texture_units`.
+       *
+       * @return `false` if it was not created, is current in another thread or GLAD
+       *         could not be loaded for its backend
+       */
+      bool make_current();
+      /**
+       * @brief Detaches this context from the calling thread
+       *
+       * @return `false` if it is not current in the calling thread
+       */
+      bool release();
+      /**
+       * @brief Getting the texture unit table of this context
+       *
+       * @return The table selected by `make_current()`
+       */
+      texture_units &units();
+      /**
+       * @brief Getting the context current in the calling thread
+       *
+       * @return The context or `nullptr` if none of them is current
+       */
+      static context *current();
+
+    private:
+      headless::backend backend_;
+      // EGLContext or OSMesaContext
+      void *handle_;
+      // 1x1 color buffer OSMesa needs to make a context current, never drawn into
+      unsigned char osmesa_buffer_[4];
+      texture_units units_;
+
+      static thread_local context *current_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_CONTEXT_H
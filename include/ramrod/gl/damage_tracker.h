@@ -0,0 +1,110 @@
+#ifndef RAMROD_GL_DAMAGE_TRACKER_H
+#define RAMROD_GL_DAMAGE_TRACKER_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Tile of the frame that changed since the previous one
+     */
+    struct damage_tile {
+      std::uint32_t column, row;
+      // pixels from the first row of the image, the bottom one for `glReadPixels`
+      GLint x, y;
+      GLsizei width, height;
+    };
+
+    struct damage_statistics {
+      std::size_t frames{0};
+      std::size_t tiles{0};
+      std::size_t dirty_tiles{0};
+      // pixel bytes of the dirty tiles, without row padding
+      std::size_t dirty_bytes{0};
+    };
+
+    /**
+     * @brief Finds the tiles of a frame that changed since the previous one
+     *
+     * Every tile of a read back frame is hashed with `pixel::tile_hashes()` and
+     * compared with the hash of the previous frame; only the tiles with a different
+     * hash are listed and copied by `pack()`. A mirror of a mostly static screen then
+     * sends bytes proportional to what changed rather than to the resolution.
+     *
+     * Give it the pixels of a mapped `readback_queue` request or of a `readback_pool`
+     * buffer, the frame is not copied.
+     */
+    class damage_tracker
+    {
+    public:
+      /**
+       * @brief Creates a tracker, the first frame is entirely dirty
+       *
+       * @param tile_size Specifies the width and height of the tiles in pixels
+       */
+      damage_tracker(const GLsizei tile_size = 64);
+      ~damage_tracker();
+      /**
+       * @brief Hashes a frame and lists the tiles that changed
+       *
+       * A frame with another size or pixel size than the previous one is entirely dirty.
+       *
+       * @param pixels      Specifies the frame
+       * @param row_bytes   Specifies the size of a row in bytes, padding included
+       * @param width       Specifies the width in pixels
+       * @param height      Specifies the height in pixels
+       * @param pixel_bytes Specifies the size of a pixel in bytes
+       * @param dirty       Returns the tiles that changed, in rows from the first one
+       *
+       * @return Number of dirty tiles
+       */
+      std::size_t detect(const void *pixels, const std::size_t row_bytes,
+                         const GLsizei width, const GLsizei height,
+                         const std::size_t pixel_bytes, std::vector<damage_tile> &dirty);
+      /**
+       * @brief Copies tiles one after the other, their rows without padding
+       *
+       * @param pixels      Specifies the frame given to `detect()`
+       * @param row_bytes   Specifies the size of a row in bytes, padding included
+       * @param pixel_bytes Specifies the size of a pixel in bytes
+       * @param tiles       Specifies the tiles given by `detect()`
+       * @param packed      Returns the pixels, its capacity is kept between frames
+       *
+       * @return Number of bytes written
+       */
+      std::size_t pack(const void *pixels, const std::size_t row_bytes,
+                       const std::size_t pixel_bytes, const std::vector<damage_tile> &tiles,
+                       std::vector<std::uint8_t> &packed) const;
+      /**
+       * @brief Makes the next frame entirely dirty, such as when a client connects
+       */
+      void reset();
+      /**
+       * @brief Getting the counters
+       *
+       * @return The counters since the tracker was created
+       */
+      const damage_statistics &statistics() const;
+      /**
+       * @brief Getting the size of the tiles
+       *
+       * @return Width and height in pixels
+       */
+      GLsizei tile_size() const;
+
+    private:
+      std::vector<std::uint64_t> hashes_, previous_;
+      GLsizei tile_size_, width_, height_;
+      std::size_t pixel_bytes_;
+      bool valid_;
+      damage_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_DAMAGE_TRACKER_H
@@ -3,12 +3,78 @@
 
 namespace ramrod {
   namespace gl {
+    namespace compression {
+      enum class format : unsigned int {
+        bc1 = 0,
+        bc4 = 1,
+        bc5 = 2,
+        bc7 = 3
+      };
+
+      enum class quality : unsigned int {
+        fast   = 0,
+        normal = 1,
+        high   = 2
+      };
+    } // namespace: compression
+
+    namespace fence {
+      enum class status : unsigned int {
+        // there is no fence to wait for
+        none     = 0,
+        signaled = 1,
+        timeout  = 2,
+        failed   = 3
+      };
+    } // namespace: fence
+
+    namespace headless {
+      enum class backend : unsigned int {
+        none      = 0,
+        automatic = 1,
+        egl       = 2,
+        osmesa    = 3
+      };
+    } // namespace: headless
+
+    namespace image {
+      enum class format : unsigned int {
+        png = 0,
+        qoi = 1
+      };
+    } // namespace: image
+
+    namespace residency {
+      enum class policy : unsigned int {
+        release  = 0,
+        drop_mip = 1
+      };
+    } // namespace: residency
+
     namespace pixel {
       enum class buffer : unsigned int {
         pack   = 0,
         unpack = 1
       };
+
+      enum class simd : unsigned int {
+        scalar = 0,
+        sse2   = 1,
+        avx2   = 2
+      };
     } // namespace: pixel_object
+
+    namespace video {
+      enum class container : unsigned int {
+        raw = 0,
+        y4m = 1
+      };
+
+      enum class layout : unsigned int {
+        i420 = 0,
+        nv12 = 1
+      };
+    } // namespace: video
   } // namespace: gl
 } // namespace: ramrod
 
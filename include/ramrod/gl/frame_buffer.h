@@ -4,8 +4,12 @@
 // OpenGL loader and core library
 #include "glad/glad.h"
 
+#include <vector>
+
 namespace ramrod {
   namespace gl {
+    class texture;
+
     class frame_buffer
     {
     public:
@@ -22,11 +26,23 @@ namespace ramrod {
        * @return false if frame buffer or render buffer have been generated
        */
       bool attach_render(const GLenum render_attachment = GL_DEPTH_ATTACHMENT);
+      /**
+       * @brief Attaches a texture using its own target, multisample textures included
+       * @return false if frame buffer or texture were not generated
+       */
+      bool attach_texture(texture &image, const GLenum attachment = GL_COLOR_ATTACHMENT0,
+                          const GLint level = 0);
       /**
        * @brief Binds the frame buffer
        * @return false if frame buffer was not generated
        */
       void bind();
+      /**
+       * @brief Checking if attachments can be invalidated
+       * @return true if GL_ARB_invalidate_subdata was loaded, otherwise invalidation does
+       *         nothing
+       */
+      static bool can_invalidate();
       /**
        * @brief Binds the render buffer
        * @return false if render was not generated
@@ -46,6 +62,18 @@ namespace ramrod {
        * @return false if render buffer does not exist
        */
       bool delete_render();
+      /**
+       * @brief Declares attachments whose content is discarded when calling `release()`
+       *
+       * Use it for depth, stencil or any attachment nobody reads after the pass, the
+       * driver does not have to store them back to memory.
+       *
+       * @param number_of_attachments Specifies the number of attachments, 0 keeps everything
+       * @param attachments Points to GL_COLOR_ATTACHMENT$m$, GL_DEPTH_ATTACHMENT,
+       *        GL_STENCIL_ATTACHMENT or GL_DEPTH_STENCIL_ATTACHMENT values
+       * @return false if frame buffer is not created yet
+       */
+      bool discard_on_release(const GLsizei number_of_attachments, const GLenum *attachments);
       /**
        * @brief Draws this frame buffer
        * @return false if render buffer does not exist
@@ -104,6 +132,11 @@ namespace ramrod {
        * @return false if render buffer was already generated
        */
       bool generate_render();
+      /**
+       * @brief Discards the content of attachments of this bound frame buffer right away
+       * @return false if frame buffer is not created yet
+       */
+      bool invalidate(const GLsizei number_of_attachments, const GLenum *attachments);
       /**
        * @brief Returns true if the Frame buffer was properly created
        * @return false if frame buffer is not created yet
@@ -112,13 +145,17 @@ namespace ramrod {
       /**
        * @brief Select a color buffer source for pixels
        *
-       * Specifies a color buffer as the source for subsequent `read_pixel`
+       * Specifies the last attached color buffer as the source for subsequent `read_pixel`
        *
-       * @return false if frame buffer is not created yet
+       * @return false if frame buffer is not created yet or nothing was attached
        */
       bool read_buffer();
       /**
        * @brief Reads a pixel from the frame buffer
+       *
+       * It waits until the GPU finishes drawing, use a `readback_queue` to read every
+       * frame without stalling.
+       *
        * @return false if frame buffer is not created yet
        */
       bool read_pixel(GLvoid *data, const GLint x, const GLint y,
@@ -126,7 +163,9 @@ namespace ramrod {
                       const GLenum type = GL_UNSIGNED_BYTE, const GLenum components = GL_RGBA);
       /**
        * @brief Releases the actual frame buffer
-       * @return false if frame buffer is not created yet
+       *
+       * The attachments given to `discard_on_release()` are invalidated first when this
+       * frame buffer is the bound one.
        */
       void release();
       /**
@@ -157,6 +196,36 @@ namespace ramrod {
        */
       bool render_storage(const GLsizei width, const GLsizei height,
                           const GLenum internal_format = GL_DEPTH_COMPONENT24);
+      /**
+       * @brief Defines multisample Render Buffer properties
+       *
+       * The samples must match the ones of the other attachments.
+       *
+       * @return false if render buffer is not created yet
+       */
+      bool render_storage_multisample(const GLsizei samples, const GLsizei width,
+                                      const GLsizei height,
+                                      const GLenum internal_format = GL_DEPTH_COMPONENT24);
+      /**
+       * @brief Copies this frame buffer into another one, resolving multisample attachments
+       *
+       * Both frame buffers must have the same size when this one is multisampled. A frame
+       * buffer that was not generated stands for the default frame buffer. The read and
+       * draw frame buffer bindings are restored afterwards.
+       *
+       * @param destination Specifies the frame buffer receiving the pixels
+       * @param width       Specifies the width of the copied region
+       * @param height      Specifies the height of the copied region
+       * @param mask        Specifies the buffers to copy: GL_COLOR_BUFFER_BIT,
+       *                    GL_DEPTH_BUFFER_BIT and/or GL_STENCIL_BUFFER_BIT
+       * @param filter      Specifies GL_NEAREST or GL_LINEAR, depth and stencil
+       *                    require GL_NEAREST
+       *
+       * @return false if this frame buffer is not created yet
+       */
+      bool resolve_to(frame_buffer &destination, const GLsizei width, const GLsizei height,
+                      const GLbitfield mask = GL_COLOR_BUFFER_BIT,
+                      const GLenum filter = GL_NEAREST);
       /**
        * @brief Returning the status of this frame buffer
        * @return for more info see
@@ -172,6 +241,7 @@ namespace ramrod {
     private:
       GLuint frame_id_, render_id_;
       GLenum frame_attachment_, render_attachment_, render_format_;
+      std::vector<GLenum> discard_;
     };
   }
 }
@@ -0,0 +1,205 @@
+#ifndef RAMROD_GL_FRAME_GRAPH_H
+#define RAMROD_GL_FRAME_GRAPH_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/render_target_pool.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    class frame_graph;
+
+    struct render_pass {
+      std::string name;
+      // resources sampled by the pass
+      std::vector<std::size_t> reads;
+      // color resources are attached in order, a depth and/or stencil resource goes to its
+      // own attachment point; no writes means the frame buffer bound before `execute()`
+      std::vector<std::size_t> writes;
+      // without GL_COLOR_BUFFER_BIT or GL_DEPTH_BUFFER_BIT the previous content of the
+      // written resources is kept, so the passes that wrote them before are kept too
+      GLbitfield clear{0};
+      std::array<GLfloat, 4> clear_color{0.0f, 0.0f, 0.0f, 0.0f};
+      GLdouble clear_depth{1.0};
+      GLint clear_stencil{0};
+      // passes with side effects are never culled
+      bool side_effect{false};
+      std::function<void(frame_graph &graph)> execute;
+    };
+
+    struct pass_timing {
+      std::string name;
+      bool culled{false};
+      double cpu_milliseconds{0.0};
+      // measured a few frames ago, GPU queries are read without waiting
+      double gpu_milliseconds{0.0};
+    };
+
+    struct frame_graph_statistics {
+      std::size_t passes{0};
+      std::size_t culled{0};
+      std::size_t frame_buffer_binds{0};
+      // passes drawing to the same attachments as the previous one, without rebinding
+      std::size_t merged{0};
+      // attachments discarded after their last pass
+      std::size_t invalidated{0};
+    };
+
+    /**
+     * @brief Orders, culls and runs render passes from their declared resources
+     *
+     * Passes are added with the resources they read and write, `compile()` sorts them,
+     * removes the ones whose results are never used and computes the first and last
+     * pass using every resource. `execute()` acquires each resource from the pool right
+     * before its first use and releases it right after its last one, so resources whose
+     * lifetimes do not overlap share the same texture. Attachments ending their lifetime
+     * in a pass are invalidated, so the driver does not store them back. Consecutive
+     * passes writing the same attachments reuse the bound frame buffer.
+     *
+     * Resources marked with `output()` stay acquired after `execute()` until
+     * `render_target_pool::end_frame()` is called.
+     */
+    class frame_graph
+    {
+    public:
+      static constexpr std::size_t invalid_resource{~std::size_t(0)};
+
+      /**
+       * @brief Creates an empty graph
+       *
+       * @param pool       Specifies where the transient resources are acquired
+       * @param gpu_timing Measures every pass with GL_TIME_ELAPSED queries
+       */
+      frame_graph(render_target_pool &pool, const bool gpu_timing = true);
+      ~frame_graph();
+      /**
+       * @brief Adds a pass at the end of the submission order
+       *
+       * Passes run in submission order except when merging passes with the same
+       * attachments, which only moves a pass earlier if it does not depend on the ones
+       * it skips.
+       *
+       * @param pass Specifies the resources, clear values and function of the pass
+       *
+       * @return Index of the pass
+       */
+      std::size_t add_pass(const render_pass &pass);
+      /**
+       * @brief Sorts and culls the passes and computes the resource lifetimes
+       *
+       * @return `false` if a pass reads a resource that no previous pass writes, writes
+       *         resources of different sizes or more than one depth resource
+       */
+      bool compile();
+      /**
+       * @brief Declares a transient resource
+       *
+       * @param name        Specifies a name for debugging
+       * @param description Specifies the size, format and samples of the resource
+       *
+       * @return Handle of the resource
+       */
+      std::size_t create(const std::string &name, const render_target_description &description);
+      /**
+       * @brief Runs the compiled passes
+       *
+       * The frame buffer binding and the viewport are restored afterwards.
+       *
+       * @return `false` if the graph is not compiled or a frame buffer is not complete
+       */
+      bool execute();
+      /**
+       * @brief Getting the texture of a resource
+       *
+       * Valid during the lifetime of the resource, that is, inside the passes using it
+       * and, for outputs, until the pool's `end_frame()`.
+       *
+       * @param resource Specifies the handle given by `create()`
+       *
+       * @return The texture or `nullptr` if the resource is not acquired or not sampled
+       */
+      texture *image(const std::size_t resource);
+      /**
+       * @brief Getting the order in which passes run
+       *
+       * @return Indices of the passes not culled, in execution order
+       */
+      const std::vector<std::size_t> &order() const;
+      /**
+       * @brief Marks a resource as a result of the frame
+       *
+       * The passes writing it and everything they depend on are not culled.
+       *
+       * @param resource Specifies the handle given by `create()`
+       *
+       * @return `false` if the handle is not valid
+       */
+      bool output(const std::size_t resource);
+      /**
+       * @brief Removes every pass and resource
+       */
+      void reset();
+      /**
+       * @brief Getting the pass and frame buffer counters of the last `execute()`
+       *
+       * @return Statistics of the last frame
+       */
+      const frame_graph_statistics &statistics() const;
+      /**
+       * @brief Getting the target of a resource
+       *
+       * @param resource Specifies the handle given by `create()`
+       *
+       * @return The target or `nullptr` if the resource is not acquired
+       */
+      render_target *target(const std::size_t resource);
+      /**
+       * @brief Getting the timing of every pass
+       *
+       * @return Timings in submission order
+       */
+      const std::vector<pass_timing> &timings() const;
+
+    private:
+      static constexpr std::size_t query_frames{3};
+
+      struct resource_node {
+        std::string name;
+        render_target_description description;
+        bool output;
+        // execution step of the first and last pass using it
+        std::size_t first, last;
+        render_target *target;
+      };
+
+      struct pass_node {
+        render_pass pass;
+        bool kept;
+        std::array<GLuint, query_frames> queries;
+        std::array<bool, query_frames> pending;
+      };
+
+      bool depends(const std::size_t later, const std::size_t earlier) const;
+      bool loads(const pass_node &node, const std::size_t resource) const;
+      void read_queries(pass_node &node, pass_timing &timing, const std::size_t slot);
+
+      render_target_pool &pool_;
+      std::vector<resource_node> resources_;
+      std::vector<pass_node> passes_;
+      std::vector<std::size_t> order_;
+      std::vector<pass_timing> timings_;
+      frame_graph_statistics statistics_;
+      std::uint64_t frame_;
+      bool compiled_, gpu_timing_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_FRAME_GRAPH_H
@@ -0,0 +1,168 @@
+#ifndef RAMROD_GL_IMAGE_ENCODER_H
+#define RAMROD_GL_IMAGE_ENCODER_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/enumerators.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    class readback_pool;
+    struct pooled_buffer;
+
+    struct encoder_statistics {
+      std::size_t queued{0};
+      std::size_t encoded{0};
+      // images that could not be encoded or written
+      std::size_t failed{0};
+      std::size_t written_bytes{0};
+      // time from `encode()` until the file of the last image was written
+      double last_milliseconds{0.0};
+    };
+
+    /**
+     * @brief Encodes and writes screenshots in background threads
+     *
+     * `encode()` takes the pixels by moving a vector, or borrows memory given back
+     * through a release callback, such as a `readback_pool` buffer; it does not copy nor
+     * convert them in the calling thread. PNG images are split in bands of rows compressed in
+     * parallel into one zlib stream (needs zlib at build time); QOI is sequential, so one
+     * thread encodes every QOI image, several images are encoded at the same time.
+     */
+    class image_encoder
+    {
+    public:
+      typedef std::function<void()> release_callback;
+
+      /**
+       * @brief Starts the threads
+       *
+       * @param threads           Specifies the number of threads, 0 uses one per
+       *                          processor core
+       * @param compression_level Specifies the zlib level of PNG images, from 1 (fast)
+       *                          to 9 (small)
+       */
+      image_encoder(const std::size_t threads = 0, const int compression_level = 6);
+      /**
+       * @brief Waits for the queued images and stops the threads
+       */
+      ~image_encoder();
+      /**
+       * @brief Queues an image
+       *
+       * @param path      Specifies the file path
+       * @param pixels    Specifies the pixels, 8 bits per channel, the vector is moved
+       * @param width     Specifies the width in pixels
+       * @param height    Specifies the height in pixels
+       * @param format    Specifies GL_RGBA, GL_BGRA, GL_RGB or GL_BGR
+       * @param flip      Reads the rows from the last one, as returned by `glReadPixels`
+       * @param type      Specifies the file format
+       * @param row_bytes Specifies the size of a row in bytes, 0 for rows without padding
+       *
+       * @return `false` if the parameters do not match the pixels or PNG is not available
+       */
+      bool encode(const std::string &path, std::vector<std::uint8_t> &&pixels,
+                  const GLsizei width, const GLsizei height, const GLenum format = GL_RGBA,
+                  const bool flip = true, const image::format type = image::format::png,
+                  const std::size_t row_bytes = 0);
+      /**
+       * @brief Queues an image stored in memory owned by the caller
+       *
+       * The memory must stay valid until `release` is called by an encoding thread, once
+       * the image was written or failed. Nothing is released if it returns `false`.
+       *
+       * @param path      Specifies the file path
+       * @param pixels    Specifies the pixels, 8 bits per channel
+       * @param size      Specifies the size of the pixels in bytes
+       * @param width     Specifies the width in pixels
+       * @param height    Specifies the height in pixels
+       * @param format    Specifies GL_RGBA, GL_BGRA, GL_RGB or GL_BGR
+       * @param flip      Reads the rows from the last one, as returned by `glReadPixels`
+       * @param type      Specifies the file format
+       * @param row_bytes Specifies the size of a row in bytes, 0 for rows without padding
+       * @param release   Specifies the function giving the memory back, it can be `nullptr`
+       *
+       * @return `false` if the parameters do not match the pixels or PNG is not available
+       */
+      bool encode(const std::string &path, const void *pixels, const std::size_t size,
+                  const GLsizei width, const GLsizei height, const GLenum format,
+                  const bool flip, const image::format type, const std::size_t row_bytes,
+                  const release_callback &release);
+      /**
+       * @brief Queues a buffer delivered by a `readback_pool`, without copying it
+       *
+       * The buffer is given back with `readback_pool::recycle()` once the image was
+       * written or failed, the pool must outlive the encoding.
+       *
+       * @param path   Specifies the file path
+       * @param buffer Specifies the buffer received by the delivery callback, read with
+       *               GL_UNSIGNED_BYTE and GL_RGBA, GL_BGRA, GL_RGB or GL_BGR
+       * @param pool   Specifies the pool owning the buffer
+       * @param type   Specifies the file format
+       *
+       * @return `false` if the buffer cannot be encoded, it stays with the caller
+       */
+      bool encode(const std::string &path, const pooled_buffer &buffer, readback_pool &pool,
+                  const image::format type = image::format::png);
+      /**
+       * @brief Getting the number of images not written yet
+       *
+       * @return Queued and encoding images
+       */
+      std::size_t pending() const;
+      /**
+       * @brief Getting the counters, safe while the threads run
+       *
+       * @return A copy of the counters
+       */
+      encoder_statistics statistics() const;
+      /**
+       * @brief Checking if PNG images can be encoded
+       *
+       * @return `true` if the library was built with zlib
+       */
+      static bool supports_png();
+      /**
+       * @brief Blocks until every queued image was written
+       */
+      void wait();
+
+    private:
+      struct job;
+
+      bool accepts(const std::string &path, const std::size_t size, const GLsizei width,
+                   const GLsizei height, const GLenum format, const image::format type,
+                   const std::size_t row_bytes) const;
+      void encode_png_band(const std::shared_ptr<job> &image, const std::size_t band);
+      void encode_qoi(const std::shared_ptr<job> &image);
+      void finish(const std::shared_ptr<job> &image, const bool success);
+      void queue(const std::shared_ptr<job> &image, const std::string &path,
+                 const GLsizei width, const GLsizei height, const GLenum format,
+                 const bool flip, const image::format type, const std::size_t row_bytes);
+      void worker();
+      bool write_png(job &image);
+
+      std::vector<std::thread> threads_;
+      std::deque<std::function<void()>> tasks_;
+      mutable std::mutex mutex_;
+      std::condition_variable work_, idle_;
+      std::size_t pending_;
+      int compression_level_;
+      bool stopping_;
+      encoder_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_IMAGE_ENCODER_H
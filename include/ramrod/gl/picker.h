@@ -0,0 +1,169 @@
+#ifndef RAMROD_GL_PICKER_H
+#define RAMROD_GL_PICKER_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/frame_buffer.h"
+#include "ramrod/gl/readback_queue.h"
+#include "ramrod/gl/render_buffer.h"
+#include "ramrod/gl/target_texture.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Finds the objects under the cursor or inside a rectangle without stalling
+     *
+     * Objects are drawn between `begin()` and `end()` by a shader writing their
+     * identifier as an unsigned integer to output 0. `pick()` and `select()` queue a copy
+     * of a small region in a `readback_queue` and return a ticket, which is resolved one
+     * or two frames later once its fence signals.
+     */
+    class picker
+    {
+    public:
+      /**
+       * @brief Creates a picker, its attachments are created by `resize()`
+       *
+       * @param background Specifies the identifier of pixels without objects
+       * @param requests   Specifies the number of requests in flight
+       */
+      picker(const std::uint32_t background = 0, const std::size_t requests = 3);
+      ~picker();
+      /**
+       * @brief Binds the identifier frame buffer and clears it
+       *
+       * The frame buffer binding and the viewport are saved until `end()`.
+       *
+       * @return `false` if `resize()` was not called
+       */
+      bool begin();
+      /**
+       * @brief Getting the identifier of pixels without objects
+       *
+       * @return The background identifier
+       */
+      std::uint32_t background() const;
+      /**
+       * @brief Drops a request
+       *
+       * @param ticket Specifies the value returned by `pick()` or `select()`
+       *
+       * @return `false` if the ticket does not exist
+       */
+      bool cancel(const std::uint64_t ticket);
+      /**
+       * @brief Restores the frame buffer and viewport saved by `begin()`
+       *
+       * The depth buffer is invalidated, only the identifiers are kept.
+       *
+       * @return `false` if `begin()` was not called
+       */
+      bool end();
+      /**
+       * @brief Getting the frame buffer the identifiers are drawn into
+       *
+       * @return The frame buffer
+       */
+      frame_buffer &frame();
+      /**
+       * @brief Getting the height of the attachments
+       *
+       * @return Height in pixels
+       */
+      GLsizei height() const;
+      /**
+       * @brief Getting the integer texture holding the identifiers
+       *
+       * @return The GL_R32UI texture
+       */
+      texture_2d &identifiers();
+      /**
+       * @brief Checking without blocking if a request can be resolved
+       *
+       * @param ticket Specifies the value returned by `pick()` or `select()`
+       *
+       * @return `true` if `result()` will not wait
+       */
+      bool is_ready(const std::uint64_t ticket);
+      /**
+       * @brief Queues the read of the identifier under a pixel
+       *
+       * @param x Specifies the horizontal pixel, from the left
+       * @param y Specifies the vertical pixel, from the bottom as in OpenGL
+       *
+       * @return Ticket of the request or 0 if the pixel is outside or the queue is full
+       */
+      std::uint64_t pick(const GLint x, const GLint y);
+      /**
+       * @brief Creates or resizes the attachments
+       *
+       * @param width  Specifies the width, usually the one of the window
+       * @param height Specifies the height, usually the one of the window
+       *
+       * @return `false` if the frame buffer is not complete
+       */
+      bool resize(const GLsizei width, const GLsizei height);
+      /**
+       * @brief Resolves a request given by `pick()`
+       *
+       * @param ticket     Specifies the value returned by `pick()`
+       * @param identifier Returns the identifier under the pixel
+       * @param wait       Blocks until the request is ready instead of failing
+       *
+       * @return `false` if the ticket does not exist or is not ready
+       */
+      bool result(const std::uint64_t ticket, std::uint32_t &identifier, const bool wait = false);
+      /**
+       * @brief Resolves a request given by `select()` or `pick()`
+       *
+       * @param ticket      Specifies the value returned by `select()`
+       * @param identifiers Returns the distinct identifiers in increasing order, the
+       *                    background is left out
+       * @param pixels      Returns how many pixels every identifier covers, it can be
+       *                    `nullptr`
+       * @param wait        Blocks until the request is ready instead of failing
+       *
+       * @return `false` if the ticket does not exist or is not ready
+       */
+      bool result(const std::uint64_t ticket, std::vector<std::uint32_t> &identifiers,
+                  std::vector<std::uint32_t> *pixels = nullptr, const bool wait = false);
+      /**
+       * @brief Queues the read of the identifiers inside a rectangle
+       *
+       * The rectangle is clipped to the attachments.
+       *
+       * @param x      Specifies the left pixel
+       * @param y      Specifies the bottom pixel
+       * @param width  Specifies the width of the rectangle
+       * @param height Specifies the height of the rectangle
+       *
+       * @return Ticket of the request or 0 if it is empty or the queue is full
+       */
+      std::uint64_t select(GLint x, GLint y, GLsizei width, GLsizei height);
+      /**
+       * @brief Getting the width of the attachments
+       *
+       * @return Width in pixels
+       */
+      GLsizei width() const;
+
+    private:
+      std::uint32_t background_;
+      texture_2d identifiers_;
+      render_buffer depth_;
+      frame_buffer frame_;
+      readback_queue readbacks_;
+      std::vector<std::uint32_t> values_, unique_, counts_;
+      GLsizei width_, height_;
+      GLint previous_frame_buffer_;
+      GLint previous_viewport_[4];
+      bool in_pass_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_PICKER_H
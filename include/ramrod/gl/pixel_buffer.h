@@ -4,6 +4,7 @@
 // OpenGL loader and core library
 #include "glad/glad.h"
 #include "ramrod/gl/enumerators.h"
+#include "ramrod/gl/sync.h"
 
 namespace ramrod {
   namespace gl {
@@ -32,6 +33,23 @@ namespace ramrod {
        * @return false if the pixel buffer has not been generated
        */
       bool bind();
+      /**
+       * @brief Copies pixels read with GL_BGRA and GL_UNSIGNED_BYTE as RGBA rows
+       *
+       * The pixel buffer must be bound and filled by `read_pixels()` with its default
+       * format and type. It is mapped, converted with `pixel::swap_red_blue()` and unmapped.
+       * The pack alignment, row length and skips must be the ones used by `read_pixels()`.
+       *
+       * @param destination   Specifies where `width * height * 4` bytes are written
+       * @param width         Specifies the width given to `read_pixels()`
+       * @param height        Specifies the height given to `read_pixels()`
+       * @param top_to_bottom Writes the first row of the image first instead of the
+       *                      bottom-to-top order of OpenGL
+       *
+       * @return false if the pixel buffer has not been generated or could not be mapped
+       */
+      bool copy_rgba(void *destination, const GLsizei width, const GLsizei height,
+                     const bool top_to_bottom = true);
       /**
        * @brief Generates a new pixel buffer object
        * @return false if the pixel buffer object was already created
@@ -76,6 +94,38 @@ namespace ramrod {
        */
       void *map_range(const GLintptr offset, const GLsizeiptr length,
                       const GLenum access = GL_MAP_READ_BIT);
+      /**
+       * @brief Maps a range once the GPU finished with the buffer, instead of blocking
+       *        inside the driver
+       *
+       * The pixel buffer must be bound.
+       *
+       * @param ready   Specifies the fence inserted after the commands using the buffer
+       * @param offset  Specifies the starting offset of the range
+       * @param length  Specifies the length of the range
+       * @param access  Specifies a combination of access flags, as in `map_range()`
+       * @param timeout Specifies the nanoseconds to wait for the fence, 0 only polls
+       *
+       * @return Pointer to the mapped data or nullptr if the fence is not signaled yet,
+       *         waiting failed or the object was not generated
+       */
+      void *map_range_when_ready(sync &ready, const GLintptr offset, const GLsizeiptr length,
+                                 const GLenum access = GL_MAP_READ_BIT,
+                                 const GLuint64 timeout = 0);
+      /**
+       * @brief Maps the whole buffer once the GPU finished with it
+       *
+       * The pixel buffer must be bound.
+       *
+       * @param ready   Specifies the fence inserted after the commands using the buffer
+       * @param access  Specifies GL_READ_ONLY, GL_WRITE_ONLY or GL_READ_WRITE
+       * @param timeout Specifies the nanoseconds to wait for the fence, 0 only polls
+       *
+       * @return Pointer to the mapped data or nullptr if the fence is not signaled yet,
+       *         waiting failed or the object was not generated
+       */
+      void *map_when_ready(sync &ready, const GLenum access = GL_READ_ONLY,
+                           const GLuint64 timeout = 0);
       /**
        * @brief Select a color buffer source for pixels
        *
@@ -0,0 +1,189 @@
+#ifndef RAMROD_GL_PIXEL_CONVERSION_H
+#define RAMROD_GL_PIXEL_CONVERSION_H
+
+#include "ramrod/gl/enumerators.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ramrod {
+  namespace gl {
+    namespace pixel {
+      /**
+       * @brief Converts BGRA pixels to planar YUV 4:2:0 (I420)
+       *
+       * BT.601 limited range, every chroma sample is the average of 2x2 pixels (centred
+       * siting, `C420jpeg` in Y4M). Odd sizes repeat the last column or row.
+       *
+       * @param bgra      Specifies the pixels
+       * @param row_bytes Specifies the size of a source row in bytes, padding included
+       * @param width     Specifies the width in pixels
+       * @param height    Specifies the height in pixels
+       * @param y         Specifies where the `width` x `height` luma plane is written
+       * @param u         Specifies where the (`width` + 1) / 2 x (`height` + 1) / 2 blue
+       *                  difference plane is written
+       * @param v         Specifies where the red difference plane is written
+       * @param flip      Reads the rows from the last one, as returned by `glReadPixels`
+       */
+      void bgra_to_i420(const std::uint8_t *bgra, const std::size_t row_bytes,
+                        const std::size_t width, const std::size_t height,
+                        std::uint8_t *y, std::uint8_t *u, std::uint8_t *v,
+                        const bool flip = false);
+      /**
+       * @brief Converts BGRA pixels to semi-planar YUV 4:2:0 (NV12)
+       *
+       * Same as `bgra_to_i420()` but the chroma samples are interleaved, U first.
+       *
+       * @param bgra      Specifies the pixels
+       * @param row_bytes Specifies the size of a source row in bytes, padding included
+       * @param width     Specifies the width in pixels
+       * @param height    Specifies the height in pixels
+       * @param y         Specifies where the `width` x `height` luma plane is written
+       * @param uv        Specifies where the (`width` + 1) / 2 x (`height` + 1) / 2 pairs
+       *                  of chroma samples are written
+       * @param flip      Reads the rows from the last one, as returned by `glReadPixels`
+       */
+      void bgra_to_nv12(const std::uint8_t *bgra, const std::size_t row_bytes,
+                        const std::size_t width, const std::size_t height,
+                        std::uint8_t *y, std::uint8_t *uv, const bool flip = false);
+      /**
+       * @brief Converts 16 bits floats to 32 bits floats
+       *
+       * @param half  Specifies the IEEE half precision values
+       * @param value Specifies where the single precision values are written
+       * @param count Specifies the number of values
+       */
+      void from_half(const std::uint16_t *half, float *value, const std::size_t count);
+      /**
+       * @brief Converts 8 bits per channel values from the sRGB curve to linear floats
+       *
+       * @param srgb   Specifies the encoded values
+       * @param linear Specifies where the linear values in [0, 1] are written
+       * @param count  Specifies the number of values (not pixels)
+       */
+      void from_srgb(const std::uint8_t *srgb, float *linear, const std::size_t count);
+      /**
+       * @brief Flips an image upside down in place
+       *
+       * Use it to turn the bottom-to-top rows of `glReadPixels` into top-to-bottom rows.
+       *
+       * @param pixels    Specifies the image
+       * @param row_bytes Specifies the size of a row in bytes, padding included
+       * @param rows      Specifies the number of rows
+       */
+      void flip_vertically(void *pixels, const std::size_t row_bytes, const std::size_t rows);
+      /**
+       * @brief Counts how many times every distinct value appears
+       *
+       * Made for object identifiers read from an integer attachment, where neighbouring
+       * pixels usually hold the same value: runs of equal values are found with SIMD
+       * comparisons and only the runs are sorted.
+       *
+       * @param values Specifies the values
+       * @param count  Specifies the number of values
+       * @param unique Specifies where the distinct values are written in increasing
+       *               order, it must hold `count` values
+       * @param counts Specifies where the number of appearances of every distinct value
+       *               is written, it can be `nullptr`
+       *
+       * @return Number of distinct values
+       */
+      std::size_t histogram(const std::uint32_t *values, const std::size_t count,
+                            std::uint32_t *unique, std::uint32_t *counts = nullptr);
+      /**
+       * @brief Getting the instruction set used by the conversions
+       *
+       * @return The best instruction set supported by the processor or the one given to
+       *         `instruction_set(simd)`
+       */
+      simd instruction_set();
+      /**
+       * @brief Limiting the instruction set used by the conversions
+       *
+       * Mostly useful to compare the implementations, a set not supported by the
+       * processor is replaced by the best supported one.
+       *
+       * @param maximum Specifies the best instruction set allowed
+       */
+      void instruction_set(const simd maximum);
+      /**
+       * @brief Drops the alpha channel of RGBA (or BGRA) pixels
+       *
+       * @param rgba   Specifies the 4 channels pixels
+       * @param rgb    Specifies where the 3 channels pixels are written, it must not
+       *               overlap `rgba`
+       * @param pixels Specifies the number of pixels
+       */
+      void rgba_to_rgb(const std::uint8_t *rgba, std::uint8_t *rgb, const std::size_t pixels);
+      /**
+       * @brief Adds an alpha channel to RGB (or BGR) pixels
+       *
+       * Drivers usually convert 3 channels uploads on the CPU one texel at a time, four
+       * channels are uploaded as they are.
+       *
+       * @param rgb    Specifies the 3 channels pixels
+       * @param rgba   Specifies where the 4 channels pixels are written, it must not
+       *               overlap `rgb`
+       * @param pixels Specifies the number of pixels
+       * @param alpha  Specifies the value of the new alpha channel
+       */
+      void rgb_to_rgba(const std::uint8_t *rgb, std::uint8_t *rgba, const std::size_t pixels,
+                       const std::uint8_t alpha = 255);
+      /**
+       * @brief Swaps the first and third channels of 4 channels pixels
+       *
+       * Converts BGRA to RGBA and RGBA to BGRA, `source` and `destination` may be the
+       * same buffer.
+       *
+       * @param source      Specifies the pixels
+       * @param destination Specifies where the swizzled pixels are written
+       * @param pixels      Specifies the number of pixels
+       */
+      void swap_red_blue(const std::uint8_t *source, std::uint8_t *destination,
+                         const std::size_t pixels);
+      /**
+       * @brief Hashes every square tile of an image, to find the tiles that changed
+       *        between two frames
+       *
+       * The hash is fast, not cryptographic, and gives the same values with every
+       * instruction set. It depends on the position of the bytes inside the tile but
+       * not on the padding of the rows.
+       *
+       * @param pixels      Specifies the image
+       * @param row_bytes   Specifies the size of a row in bytes, padding included
+       * @param width       Specifies the width in pixels
+       * @param height      Specifies the height in pixels
+       * @param pixel_bytes Specifies the size of a pixel in bytes
+       * @param tile_size   Specifies the width and height of a tile in pixels, the tiles
+       *                    of the last column and row may be smaller
+       * @param hashes      Specifies where the hashes are written, one per tile in rows
+       *                    following the rows of the image, it must hold
+       *                    ceil(`width` / `tile_size`) * ceil(`height` / `tile_size`) values
+       */
+      void tile_hashes(const std::uint8_t *pixels, const std::size_t row_bytes,
+                       const std::size_t width, const std::size_t height,
+                       const std::size_t pixel_bytes, const std::size_t tile_size,
+                       std::uint64_t *hashes);
+      /**
+       * @brief Converts 32 bits floats to 16 bits floats rounding to nearest even
+       *
+       * @param value Specifies the single precision values
+       * @param half  Specifies where the IEEE half precision values are written
+       * @param count Specifies the number of values
+       */
+      void to_half(const float *value, std::uint16_t *half, const std::size_t count);
+      /**
+       * @brief Converts linear floats to 8 bits per channel values on the sRGB curve
+       *
+       * Values are clamped to [0, 1], the result is within one step of the exact curve.
+       *
+       * @param linear Specifies the linear values
+       * @param srgb   Specifies where the encoded values are written
+       * @param count  Specifies the number of values (not pixels)
+       */
+      void to_srgb(const float *linear, std::uint8_t *srgb, const std::size_t count);
+    } // namespace: pixel
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_PIXEL_CONVERSION_H
@@ -0,0 +1,189 @@
+#ifndef RAMROD_GL_READBACK_POOL_H
+#define RAMROD_GL_READBACK_POOL_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/readback_queue.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    class frame_buffer;
+
+    /**
+     * @brief Buffer of a `readback_pool` holding the pixels of a finished read
+     */
+    struct pooled_buffer {
+      std::uint8_t *data{nullptr};
+      std::size_t capacity{0};
+      // bytes written, rows from bottom to top with the pack alignment padding
+      std::size_t size{0};
+      std::size_t row_bytes{0};
+      GLsizei width{0}, height{0};
+      GLenum format{GL_NONE}, type{GL_NONE};
+      std::uint64_t ticket{0};
+      // position in the pool, given back to `readback_pool::recycle()`
+      std::size_t index{0};
+    };
+
+    struct readback_pool_statistics {
+      std::size_t requested{0};
+      std::size_t delivered{0};
+      std::size_t recycled{0};
+      // reads refused because no free buffer was big enough
+      std::size_t starved{0};
+      // buffers allocated by `allocate()` which got explicit huge pages
+      std::size_t huge_pages{0};
+    };
+
+    /**
+     * @brief Reads pixels into buffers registered up front, without allocating per frame
+     *
+     * The buffers come from the caller with `add()` or are allocated once by
+     * `allocate()`, page aligned and optionally backed by huge pages. `read()` takes a
+     * free buffer and queues the read in a `readback_queue`; `update()` copies the
+     * ready reads into their buffers and hands them to the delivery callback, in read
+     * order. The buffer stays with the caller until it gives it back with `recycle()`,
+     * from any thread, so after the buffers are registered the readback loop does not
+     * touch the heap.
+     *
+     * The OpenGL context must be current in the thread calling `read()` and `update()`.
+     */
+    class readback_pool
+    {
+    public:
+      typedef std::function<void(const pooled_buffer &buffer)> delivery_callback;
+
+      /**
+       * @brief Creates an empty pool
+       *
+       * @param deliver   Specifies the function receiving the filled buffers
+       * @param in_flight Specifies the number of reads queued in the GPU
+       */
+      readback_pool(const delivery_callback &deliver, const std::size_t in_flight = 3);
+      ~readback_pool();
+      /**
+       * @brief Registers memory owned by the caller
+       *
+       * It must stay valid until the pool is destroyed.
+       *
+       * @param data     Specifies the memory
+       * @param capacity Specifies its size in bytes
+       *
+       * @return `false` if `data` is `nullptr` or `capacity` is 0
+       */
+      bool add(void *data, const std::size_t capacity);
+      /**
+       * @brief Allocates buffers owned by the pool, freed when it is destroyed
+       *
+       * Buffers are page aligned. With `huge_pages`, explicit huge pages are requested
+       * first and transparent huge pages are advised when none is reserved; Windows
+       * always uses regular pages.
+       *
+       * @param count      Specifies the number of buffers
+       * @param bytes      Specifies the size of every buffer, usually the value of
+       *                   `readback_queue::required_size()`
+       * @param huge_pages Backs the buffers with huge pages when possible
+       *
+       * @return `false` if the parameters are 0 or the memory cannot be allocated,
+       *         the buffers allocated before the failure stay in the pool
+       */
+      bool allocate(const std::size_t count, const std::size_t bytes,
+                    const bool huge_pages = false);
+      /**
+       * @brief Getting the number of free buffers, safe from any thread
+       *
+       * @return Buffers not read into nor delivered
+       */
+      std::size_t available() const;
+      /**
+       * @brief Getting the number of reads queued in the GPU
+       *
+       * @return Reads not delivered yet
+       */
+      std::size_t pending() const;
+      /**
+       * @brief Queues the read of the current read frame buffer into a free buffer
+       *
+       * GL_PACK_ALIGNMENT is honoured, as in `readback_queue`.
+       *
+       * @param x      Specifies the left pixel
+       * @param y      Specifies the bottom pixel
+       * @param width  Specifies the width of the rectangle
+       * @param height Specifies the height of the rectangle
+       * @param format Specifies the format of the pixel data
+       * @param type   Specifies the data type of the pixel data
+       *
+       * @return Ticket of the read, or 0 if no free buffer is big enough or every
+       *         read is in flight
+       */
+      std::uint64_t read(const GLint x, const GLint y, const GLsizei width, const GLsizei height,
+                         const GLenum format = GL_RGBA, const GLenum type = GL_UNSIGNED_BYTE);
+      /**
+       * @brief Queues the read of a frame buffer attachment into a free buffer
+       *
+       * @param source     Specifies the frame buffer
+       * @param attachment Specifies the color attachment
+       *
+       * @return Ticket of the read, or 0 if the frame buffer was not created, no free
+       *         buffer is big enough or every read is in flight
+       */
+      std::uint64_t read(frame_buffer &source, const GLenum attachment,
+                         const GLint x, const GLint y, const GLsizei width, const GLsizei height,
+                         const GLenum format = GL_RGBA, const GLenum type = GL_UNSIGNED_BYTE);
+      /**
+       * @brief Gives a delivered buffer back to the pool, safe from any thread
+       *
+       * @param buffer Specifies the buffer received by the delivery callback
+       *
+       * @return `false` if it does not belong to this pool or is already free
+       */
+      bool recycle(const pooled_buffer &buffer);
+      /**
+       * @brief Getting the counters, safe from any thread
+       *
+       * @return A copy of the counters
+       */
+      readback_pool_statistics statistics() const;
+      /**
+       * @brief Delivers the reads which are ready, in read order
+       *
+       * @param wait Blocks until every read in flight is delivered
+       */
+      void update(const bool wait = false);
+
+    private:
+      struct entry {
+        pooled_buffer buffer;
+        // bytes given to munmap(), 0 if not mapped by the pool
+        std::size_t mapped;
+        bool owned, free;
+      };
+
+      std::uint64_t queue(const GLsizei width, const GLsizei height,
+                          const GLenum format, const GLenum type,
+                          frame_buffer *source, const GLenum attachment,
+                          const GLint x, const GLint y);
+      bool register_buffer(std::uint8_t *data, const std::size_t capacity,
+                           const std::size_t mapped, const bool owned);
+
+      delivery_callback deliver_;
+      readback_queue readbacks_;
+      std::vector<entry> entries_;
+      // buffer indices in read order, `in_flight` entries reserved up front
+      std::vector<std::size_t> in_flight_;
+      std::size_t max_in_flight_;
+
+      // guards `free` and the counters, `recycle()` may come from another thread
+      mutable std::mutex mutex_;
+      readback_pool_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_READBACK_POOL_H
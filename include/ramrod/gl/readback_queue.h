@@ -0,0 +1,186 @@
+#ifndef RAMROD_GL_READBACK_QUEUE_H
+#define RAMROD_GL_READBACK_QUEUE_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/pixel_buffer.h"
+#include "ramrod/gl/sync.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    class frame_buffer;
+
+    struct readback_statistics {
+      std::size_t requested{0};
+      std::size_t completed{0};
+      // requests refused because every slot was busy
+      std::size_t dropped{0};
+      // waits that blocked because the fence was not signaled yet
+      std::size_t stalls{0};
+      std::size_t total_bytes{0};
+    };
+
+    /**
+     * @brief Reads pixels into a ring of pixel pack buffers without stalling
+     *
+     * `read()` only queues the copy on the GPU and fences it, it returns a ticket that
+     * becomes ready one or two frames later. Ready tickets are copied out with `fetch()`
+     * or mapped in place with `map()`. Every ticket holds its slot until it is fetched,
+     * released or cancelled, so a ring of three slots sustains one full frame per frame
+     * when tickets are consumed two frames after being requested.
+     *
+     * GL_PACK_ROW_LENGTH, GL_PACK_SKIP_PIXELS and GL_PACK_SKIP_ROWS must be 0,
+     * GL_PACK_ALIGNMENT is honoured.
+     */
+    class readback_queue
+    {
+    public:
+      /**
+       * @brief Creates a queue, the pixel buffers are generated when first used
+       *
+       * @param slots Specifies the number of requests in flight
+       */
+      readback_queue(const std::size_t slots = 3);
+      ~readback_queue();
+      /**
+       * @brief Drops a request without reading it
+       *
+       * @param ticket Specifies the value returned by `read()`
+       *
+       * @return `false` if the ticket does not exist
+       */
+      bool cancel(const std::uint64_t ticket);
+      /**
+       * @brief Copies the pixels of a ready request and frees its slot
+       *
+       * Rows are kept in the bottom-to-top order of OpenGL, with the pack alignment
+       * padding.
+       *
+       * @param ticket      Specifies the value returned by `read()`
+       * @param destination Specifies where `size(ticket)` bytes are written
+       * @param wait        Blocks until the request is ready instead of failing
+       *
+       * @return `false` if the ticket does not exist, is not ready or cannot be mapped
+       */
+      bool fetch(const std::uint64_t ticket, void *destination, const bool wait = false);
+      /**
+       * @brief Checking without blocking if a request can be fetched
+       *
+       * @param ticket Specifies the value returned by `read()`
+       *
+       * @return `true` if the GPU finished writing the pixels
+       */
+      bool is_ready(const std::uint64_t ticket);
+      /**
+       * @brief Maps the pixels of a ready request
+       *
+       * The pixel pack buffer binding is restored afterwards. The pointer stays valid
+       * until `release()`.
+       *
+       * @param ticket Specifies the value returned by `read()`
+       * @param wait   Blocks until the request is ready instead of failing
+       *
+       * @return Pointer to `size(ticket)` bytes or `nullptr` if it is not ready
+       */
+      const void *map(const std::uint64_t ticket, const bool wait = false);
+      /**
+       * @brief Getting the number of slots holding a request
+       *
+       * @return Requests not fetched, released or cancelled yet
+       */
+      std::size_t pending() const;
+      /**
+       * @brief Queues a copy of the bound read frame buffer
+       *
+       * @param x      Specifies the left pixel of the rectangle
+       * @param y      Specifies the bottom pixel of the rectangle
+       * @param width  Specifies the width of the rectangle
+       * @param height Specifies the height of the rectangle
+       * @param format Specifies the format of the pixel data, GL_BGRA is the fastest
+       *               for 8 bits color buffers on most drivers
+       * @param type   Specifies the data type of the pixel data
+       *
+       * @return Ticket of the request or 0 if every slot is busy or the format is not
+       *         supported
+       */
+      std::uint64_t read(const GLint x, const GLint y, const GLsizei width, const GLsizei height,
+                         const GLenum format = GL_BGRA, const GLenum type = GL_UNSIGNED_BYTE);
+      /**
+       * @brief Queues a copy of an attachment of a frame buffer
+       *
+       * The read frame buffer binding and its read buffer are restored afterwards, see
+       * the other `read()` for the parameters.
+       *
+       * @param source     Specifies the frame buffer
+       * @param attachment Specifies the color attachment read
+       *
+       * @return Ticket of the request or 0 on failure
+       */
+      std::uint64_t read(frame_buffer &source, const GLenum attachment,
+                         const GLint x, const GLint y, const GLsizei width, const GLsizei height,
+                         const GLenum format = GL_BGRA, const GLenum type = GL_UNSIGNED_BYTE);
+      /**
+       * @brief Unmaps a request given by `map()` and frees its slot
+       *
+       * @param ticket Specifies the value returned by `read()`
+       *
+       * @return `false` if the ticket is not mapped
+       */
+      bool release(const std::uint64_t ticket);
+      /**
+       * @brief Computes the size of a read with the current GL_PACK_ALIGNMENT
+       *
+       * @param width     Specifies the width of the rectangle
+       * @param height    Specifies the height of the rectangle
+       * @param format    Specifies the format of the pixel data
+       * @param type      Specifies the data type of the pixel data
+       * @param row_bytes Returns the size of a row, padding included, it can be `nullptr`
+       *
+       * @return Size in bytes, the last row is not padded, or 0 if the format is not
+       *         supported
+       */
+      static std::size_t required_size(const GLsizei width, const GLsizei height,
+                                        const GLenum format, const GLenum type,
+                                        std::size_t *row_bytes = nullptr);
+      /**
+       * @brief Getting the size of the pixels of a request
+       *
+       * @param ticket Specifies the value returned by `read()`
+       *
+       * @return Size in bytes, padding included, or 0 if the ticket does not exist
+       */
+      std::size_t size(const std::uint64_t ticket) const;
+      /**
+       * @brief Getting the request counters
+       *
+       * @return Statistics since the creation of the queue
+       */
+      const readback_statistics &statistics() const;
+
+    private:
+      struct slot {
+        pixel_buffer buffer;
+        sync fence;
+        std::uint64_t ticket;
+        // bytes of the data store and of the current request
+        std::size_t capacity, size;
+        bool mapped;
+      };
+
+      slot *find(const std::uint64_t ticket);
+      const slot *find(const std::uint64_t ticket) const;
+      void free(slot &item);
+      bool signaled(slot &item, const bool wait);
+
+      std::vector<slot> slots_;
+      std::uint64_t next_ticket_;
+      readback_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_READBACK_QUEUE_H
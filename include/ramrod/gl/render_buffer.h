@@ -44,15 +44,29 @@ namespace ramrod {
        * @brief Releases the actual render_buffer
        */
       void release();
+      /**
+       * @brief Returns the number of samples per pixel
+       * @return Samples the driver allocated in `storage_multisample()`, which may be more
+       *         than requested, or 0 for single sampled storage
+       */
+      GLsizei samples();
       /**
        * @brief Establish data storage, format and dimensions of a render_buffer object's image.
        * @return false if render_buffer has not yet been created
        */
       bool storage(const GLsizei width, const GLsizei height,
                    const GLenum format = GL_DEPTH24_STENCIL8);
+      /**
+       * @brief Establish multisample data storage, format and dimensions of the bound
+       *        render_buffer, the driver may round `samples` up
+       * @return false if render_buffer has not yet been created
+       */
+      bool storage_multisample(const GLsizei samples, const GLsizei width, const GLsizei height,
+                               const GLenum format = GL_DEPTH24_STENCIL8);
 
     private:
       GLuint id_;
+      GLsizei samples_;
     };
   }
 }
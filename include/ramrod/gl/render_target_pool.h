@@ -0,0 +1,198 @@
+#ifndef RAMROD_GL_RENDER_TARGET_POOL_H
+#define RAMROD_GL_RENDER_TARGET_POOL_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/frame_buffer.h"
+#include "ramrod/gl/render_buffer.h"
+#include "ramrod/gl/target_texture.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    struct render_target_description {
+      GLsizei width{0};
+      GLsizei height{0};
+      GLenum internal_format{GL_RGBA8};
+      // 0 for a single sampled target
+      GLsizei samples{0};
+      // a texture can be sampled by later passes, a render buffer cannot
+      bool sampled{true};
+
+      bool operator==(const render_target_description &other) const;
+      bool operator!=(const render_target_description &other) const;
+    };
+
+    struct render_target_description_hash {
+      std::size_t operator()(const render_target_description &description) const;
+    };
+
+    struct render_pool_statistics {
+      std::size_t created{0};
+      std::size_t reused{0};
+      std::size_t destroyed{0};
+      std::size_t targets{0};
+      std::size_t frame_buffers{0};
+      std::size_t bytes{0};
+      std::size_t peak_bytes{0};
+    };
+
+    /**
+     * @brief Texture or render buffer owned by a `render_target_pool`
+     */
+    class render_target
+    {
+    public:
+      render_target(const render_target_description &description);
+      ~render_target();
+      /**
+       * @brief Getting the attachment point matching the internal format
+       *
+       * @return GL_DEPTH_STENCIL_ATTACHMENT, GL_DEPTH_ATTACHMENT, GL_STENCIL_ATTACHMENT
+       *         or GL_COLOR_ATTACHMENT0
+       */
+      GLenum attachment() const;
+      /**
+       * @brief Getting the attachment point of an internal format
+       *
+       * @param internal_format Specifies the sized internal format
+       *
+       * @return GL_DEPTH_STENCIL_ATTACHMENT, GL_DEPTH_ATTACHMENT, GL_STENCIL_ATTACHMENT
+       *         or GL_COLOR_ATTACHMENT0
+       */
+      static GLenum attachment(const GLenum internal_format);
+      /**
+       * @brief Getting the description used to create this target
+       *
+       * @return Size, format, samples and kind of this target
+       */
+      const render_target_description &description() const;
+      /**
+       * @brief Getting the OpenGL name of the texture or render buffer
+       *
+       * @return The name or 0 if it could not be created
+       */
+      GLuint id();
+      /**
+       * @brief Getting the texture to sample this target in a later pass
+       *
+       * @return The texture or `nullptr` for render buffers
+       */
+      texture *image();
+      /**
+       * @brief Estimating the video memory used by this target
+       *
+       * @return Size in bytes
+       */
+      std::size_t memory_size() const;
+      /**
+       * @brief Getting the kind of OpenGL object
+       *
+       * @return GL_TEXTURE_2D, GL_TEXTURE_2D_MULTISAMPLE or GL_RENDERBUFFER
+       */
+      GLenum target() const;
+
+    private:
+      friend class render_target_pool;
+
+      render_target_description description_;
+      texture_2d image_;
+      texture_2d_multisample multisample_image_;
+      render_buffer storage_;
+      std::size_t bytes_;
+      std::uint64_t last_used_;
+      bool in_use_;
+    };
+
+    /**
+     * @brief Hands out transient render targets and frame buffers
+     *
+     * Passes acquire their attachments and release them as soon as no later pass reads
+     * them, a following pass asking for the same size, format and samples gets the same
+     * object back. Targets still acquired at `end_frame()` are released, and targets not
+     * used for a few frames are deleted. Frame buffers are cached by attachment set, so
+     * the same combination of targets always gets the same complete frame buffer.
+     */
+    class render_target_pool
+    {
+    public:
+      /**
+       * @brief Creates an empty pool
+       *
+       * @param frames_to_keep Specifies how many frames an unused target survives
+       */
+      render_target_pool(const unsigned int frames_to_keep = 2);
+      ~render_target_pool();
+      /**
+       * @brief Gets a free target matching the description or creates one
+       *
+       * @param description Specifies the size, format, samples and kind of target
+       *
+       * @return The target, owned by the pool, or `nullptr` if the description is invalid
+       */
+      render_target *acquire(const render_target_description &description);
+      /**
+       * @brief Gets and binds the frame buffer of an attachment set
+       *
+       * Color targets are attached in order to GL_COLOR_ATTACHMENT0 onwards and become
+       * the draw buffers.
+       *
+       * @param colors Specifies the color targets
+       * @param depth  Specifies the depth and/or stencil target, it can be `nullptr`
+       *
+       * @return The bound frame buffer, owned by the pool, or `nullptr` if it is not complete
+       */
+      frame_buffer *acquire_frame_buffer(const std::vector<render_target*> &colors,
+                                         render_target *depth = nullptr);
+      /**
+       * @brief Deletes every target and frame buffer
+       *
+       * Pointers given by this pool become invalid.
+       */
+      void clear();
+      /**
+       * @brief Releases every acquired target and deletes the ones unused for too long
+       *
+       * Call it once at the end of every frame. Deleted targets invalidate their pointers
+       * and the frame buffers using them.
+       */
+      void end_frame();
+      /**
+       * @brief Returns a target to the pool
+       *
+       * Its content is kept until another pass acquires it.
+       *
+       * @param target Specifies a target acquired from this pool
+       *
+       * @return `false` if the target was not acquired
+       */
+      bool release(render_target *target);
+      /**
+       * @brief Getting the pool counters
+       *
+       * @return Created, reused and alive objects and their estimated memory
+       */
+      const render_pool_statistics &statistics() const;
+
+    private:
+      void destroy(render_target *target);
+
+      std::vector<std::unique_ptr<render_target>> targets_;
+      std::unordered_map<render_target_description, std::vector<render_target*>,
+                         render_target_description_hash> free_;
+      // color targets followed by the depth target (or nullptr)
+      std::map<std::vector<const render_target*>, std::unique_ptr<frame_buffer>> frame_buffers_;
+      std::uint64_t frame_;
+      unsigned int frames_to_keep_;
+      render_pool_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_RENDER_TARGET_POOL_H
@@ -0,0 +1,126 @@
+#ifndef RAMROD_GL_SAMPLER_H
+#define RAMROD_GL_SAMPLER_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+
+#include <cstddef>
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Full state of a sampler object
+     *
+     * Two samplers with equal states sample identically, this is the key used by
+     * `sampler_cache` to share sampler objects between textures.
+     */
+    struct sampler_state {
+      GLint wrap_s{GL_REPEAT};
+      GLint wrap_t{GL_REPEAT};
+      GLint wrap_r{GL_REPEAT};
+      GLint min_filter{GL_LINEAR_MIPMAP_LINEAR};
+      GLint mag_filter{GL_LINEAR};
+      GLint compare_mode{GL_NONE};
+      GLint compare_function{GL_LEQUAL};
+      GLfloat min_lod{-1000.0f};
+      GLfloat max_lod{1000.0f};
+      GLfloat lod_bias{0.0f};
+      GLfloat max_anisotropy{1.0f};
+      GLfloat border_color[4]{0.0f, 0.0f, 0.0f, 0.0f};
+
+      bool operator==(const sampler_state &other) const;
+      bool operator!=(const sampler_state &other) const;
+    };
+
+    struct sampler_state_hash {
+      std::size_t operator()(const sampler_state &state) const;
+    };
+
+    class sampler
+    {
+    public:
+      /**
+       * @brief Creates a sampler object
+       *
+       * @param create Indicates if the sampler's name should be generated right away
+       */
+      sampler(const bool create = false);
+      /**
+       * @brief Deletes this named sampler
+       */
+      ~sampler();
+      /**
+       * @brief Binds this sampler to a texture unit
+       *
+       * @param unit Specifies the index of the texture unit, integer starting from 0
+       *
+       * @return `false` if the sampler has not been generated yet
+       */
+      bool bind(const GLuint unit) const;
+      /**
+       * @brief Deletes this named sampler
+       *
+       * @return `false` if the sampler has not been generated yet
+       */
+      bool delete_sampler();
+      /**
+       * @brief Generates the sampler's name
+       *
+       * @return `false` if the sampler was already generated
+       */
+      bool generate();
+      /**
+       * @brief Obtaining the sampler name
+       *
+       * @return The sampler's name
+       */
+      GLuint id() const;
+      /**
+       * @brief Setting every parameter of this sampler
+       *
+       * @param new_state Specifies the complete sampler state
+       *
+       * @return `false` if the sampler has not been generated yet
+       */
+      bool parameter(const sampler_state &new_state);
+      /**
+       * @brief Setting integer sampler parameters
+       *
+       * @param parameter_name Specifies the symbolic name of a single-valued sampler parameter.
+       * @param value          specifies the integer value of parameter_name.
+       *
+       * @return `false` if the sampler has not been generated yet
+       */
+      bool parameter(const GLenum parameter_name, const GLint value);
+      /**
+       * @brief Setting floating sampler parameters
+       *
+       * @param parameter_name Specifies the symbolic name of a single-valued sampler parameter.
+       * @param value          specifies the floating value of parameter_name.
+       *
+       * @return `false` if the sampler has not been generated yet
+       */
+      bool parameter(const GLenum parameter_name, const GLfloat value);
+      /**
+       * @brief Releases any sampler bound to a texture unit
+       *
+       * The texture bound to that unit will use its own texture parameters again.
+       *
+       * @param unit Specifies the index of the texture unit, integer starting from 0
+       */
+      static void release(const GLuint unit);
+      /**
+       * @brief Getting the state last set with `parameter(const sampler_state&)`
+       *
+       * @return This sampler's state
+       */
+      const sampler_state &state() const;
+
+    private:
+      GLuint id_;
+      sampler_state state_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_SAMPLER_H
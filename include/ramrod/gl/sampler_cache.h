@@ -0,0 +1,61 @@
+#ifndef RAMROD_GL_SAMPLER_CACHE_H
+#define RAMROD_GL_SAMPLER_CACHE_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/sampler.h"
+
+#include <memory>
+#include <unordered_map>
+
+namespace ramrod {
+  namespace gl {
+    class sampler_cache
+    {
+    public:
+      /**
+       * @brief Creates an empty cache, sampler objects are generated on demand
+       */
+      sampler_cache();
+      /**
+       * @brief Deletes every sampler object created by this cache
+       */
+      ~sampler_cache();
+      /**
+       * @brief Obtaining the shared sampler that matches a state
+       *
+       * The sampler is created and configured the first time a state is requested,
+       * following requests with an equal state return the same object.
+       *
+       * @param state Specifies the complete sampler state
+       *
+       * @return Shared sampler or `nullptr` if the sampler object could not be generated
+       */
+      const sampler *acquire(const sampler_state &state);
+      /**
+       * @brief Binds the shared sampler that matches a state to a texture unit
+       *
+       * @param unit  Specifies the index of the texture unit, integer starting from 0
+       * @param state Specifies the complete sampler state
+       *
+       * @return `false` if the sampler object could not be generated
+       */
+      bool bind(const GLuint unit, const sampler_state &state);
+      /**
+       * @brief Deletes every sampler object created by this cache
+       */
+      void clear();
+      /**
+       * @brief Getting the number of distinct sampler objects
+       *
+       * @return Number of cached sampler objects
+       */
+      std::size_t size() const;
+
+    private:
+      std::unordered_map<sampler_state, std::unique_ptr<sampler>, sampler_state_hash> samplers_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_SAMPLER_CACHE_H
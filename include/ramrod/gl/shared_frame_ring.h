@@ -0,0 +1,272 @@
+#ifndef RAMROD_GL_SHARED_FRAME_RING_H
+#define RAMROD_GL_SHARED_FRAME_RING_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/readback_queue.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+
+namespace ramrod {
+  namespace gl {
+    class frame_buffer;
+
+    // the counters are shared between processes, they cannot need a lock
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "shared frame rings need lock-free 64 bits atomics");
+
+    /**
+     * @brief First 4096 bytes of a shared frame ring, the slots follow it
+     */
+    struct shared_ring_header {
+      // written last by the producer, readers refuse the ring until it is set
+      std::atomic<std::uint32_t> magic;
+      std::uint32_t version;
+      std::uint32_t slots;
+      std::uint32_t width, height;
+      // GL_RGBA, GL_BGRA... and GL_UNSIGNED_BYTE, GL_FLOAT...
+      std::uint32_t format, type;
+      // padded row size following GL_PACK_ALIGNMENT, rows go from bottom to top
+      std::uint64_t row_bytes;
+      std::uint64_t frame_bytes;
+      // distance between slots, a multiple of the page size
+      std::uint64_t slot_stride;
+      // sequence of the newest complete frame, 0 before the first one
+      std::atomic<std::uint64_t> latest;
+    };
+
+    /**
+     * @brief Header of every slot, the pixels start 64 bytes after it
+     *
+     * `lock` is a sequence lock: it is `2 * sequence - 1` while frame `sequence` is
+     * being written and `2 * sequence` once it is complete.
+     */
+    struct alignas(64) shared_slot_header {
+      std::atomic<std::uint64_t> lock;
+      std::uint64_t sequence;
+      // std::chrono::steady_clock nanoseconds when the frame was published
+      std::uint64_t timestamp;
+    };
+
+    struct shared_ring_statistics {
+      std::size_t captured{0};
+      std::size_t published{0};
+      // captures which waited because every read was in flight
+      std::size_t stalls{0};
+      // reads which could not be mapped
+      std::size_t dropped{0};
+    };
+
+    /**
+     * @brief Frame found by `shared_frame_reader::acquire()`, it points into the ring
+     */
+    struct shared_frame {
+      const std::uint8_t *pixels{nullptr};
+      std::uint64_t sequence{0};
+      std::uint64_t timestamp{0};
+      GLsizei width{0}, height{0};
+      GLenum format{GL_NONE}, type{GL_NONE};
+      std::size_t row_bytes{0};
+      std::size_t size{0};
+    };
+
+    /**
+     * @brief Publishes the rendered frames into a POSIX shared memory ring
+     *
+     * Other processes, such as a streaming server or a recorder, open the ring by name
+     * with `shared_frame_reader` and read the frames in place, without sockets or pipes.
+     * `capture()` queues an asynchronous read in a `readback_queue`; once the GPU
+     * finished, the pixel buffer is mapped and copied once into the next slot, which is
+     * the only copy of the frame. Slots are written under a sequence lock and published
+     * by advancing `latest`, so the producer never waits for its readers: a reader
+     * which falls behind detects that its slot was overwritten.
+     *
+     * The OpenGL context must be current in the thread calling `capture()`, `flush()`,
+     * `update()` and `destroy()`.
+     */
+    class shared_frame_ring
+    {
+    public:
+      /**
+       * @brief Creates a ring, the shared memory is created by `create()`
+       *
+       * @param slots     Specifies the number of frames kept in the shared memory
+       * @param in_flight Specifies the number of reads queued in the GPU
+       */
+      shared_frame_ring(const std::size_t slots = 4, const std::size_t in_flight = 2);
+      ~shared_frame_ring();
+      /**
+       * @brief Queues the read of the current read frame buffer
+       *
+       * Reads the `width` x `height` pixels of the bottom left corner and publishes
+       * the reads which are ready. When every read is in flight, the oldest one is
+       * waited for.
+       *
+       * @return `false` if the ring was not created or the read could not be queued
+       */
+      bool capture();
+      /**
+       * @brief Queues the read of a frame buffer attachment
+       *
+       * @param source     Specifies the frame buffer
+       * @param attachment Specifies the color attachment
+       *
+       * @return `false` if the ring was not created, the frame buffer was not created
+       *         or the read could not be queued
+       */
+      bool capture(frame_buffer &source, const GLenum attachment = GL_COLOR_ATTACHMENT0);
+      /**
+       * @brief Creates the shared memory object
+       *
+       * An object with the same name is unlinked first, the readers still mapping it
+       * keep their memory. The row size follows the current GL_PACK_ALIGNMENT, which
+       * must not change until `destroy()`.
+       *
+       * @param name   Specifies the name, starting with '/' as in `shm_open()`
+       * @param width  Specifies the width of the frames
+       * @param height Specifies the height of the frames
+       * @param format Specifies the format of the pixel data
+       * @param type   Specifies the data type of the pixel data
+       *
+       * @return `false` if it was already created, the parameters are not valid or
+       *         the object cannot be created
+       */
+      bool create(const std::string &name, const GLsizei width, const GLsizei height,
+                  const GLenum format = GL_RGBA, const GLenum type = GL_UNSIGNED_BYTE);
+      /**
+       * @brief Drops the reads in flight, unmaps and unlinks the shared memory
+       *
+       * @return `false` if it was not created
+       */
+      bool destroy();
+      /**
+       * @brief Waits for every read in flight and publishes it
+       *
+       * @return `false` if it was not created
+       */
+      bool flush();
+      /**
+       * @brief Checking if the shared memory was created
+       *
+       * @return `true` between `create()` and `destroy()`
+       */
+      bool is_created() const;
+      /**
+       * @brief Getting the sequence of the newest published frame
+       *
+       * @return The sequence, starting at 1, or 0 if nothing was published
+       */
+      std::uint64_t published() const;
+      /**
+       * @brief Getting the counters
+       *
+       * @return The counters since the object was constructed
+       */
+      const shared_ring_statistics &statistics() const;
+      /**
+       * @brief Publishes the reads which are ready without blocking
+       *
+       * `capture()` calls it, call it once per frame when not capturing.
+       */
+      void update();
+
+    private:
+      bool publish(const bool wait);
+      bool submit(const std::uint64_t ticket);
+
+      readback_queue readbacks_;
+      // tickets in capture order
+      std::deque<std::uint64_t> pending_;
+      std::string name_;
+      std::uint8_t *memory_;
+      std::size_t memory_size_;
+      std::size_t slots_;
+      std::size_t in_flight_;
+      std::uint64_t sequence_;
+      GLsizei width_, height_;
+      GLenum format_, type_;
+      shared_ring_statistics statistics_;
+    };
+
+    /**
+     * @brief Reads the frames of a `shared_frame_ring` created by another process
+     *
+     * The frames are not copied: `acquire()` points into the shared memory and
+     * `is_valid()` tells afterwards if the producer overwrote the slot meanwhile, in
+     * which case whatever was read must be discarded. It does not need OpenGL.
+     */
+    class shared_frame_reader
+    {
+    public:
+      shared_frame_reader();
+      ~shared_frame_reader();
+      /**
+       * @brief Finds the newest complete frame
+       *
+       * @param frame Returns the frame
+       *
+       * @return `false` if it is not open, nothing was published or the newest slot
+       *         is being written, then try again
+       */
+      bool acquire(shared_frame &frame) const;
+      /**
+       * @brief Unmaps the shared memory
+       *
+       * @return `false` if it was not open
+       */
+      bool close();
+      /**
+       * @brief Copies a frame and validates it
+       *
+       * @param frame       Specifies the frame given by `acquire()`
+       * @param destination Specifies memory of at least `frame.size` bytes
+       *
+       * @return `false` if the slot was overwritten while copying
+       */
+      bool copy(const shared_frame &frame, void *destination) const;
+      /**
+       * @brief Checking if the slot of a frame still holds it
+       *
+       * Call it after reading the pixels.
+       *
+       * @param frame Specifies the frame given by `acquire()`
+       *
+       * @return `false` if the producer started overwriting it
+       */
+      bool is_valid(const shared_frame &frame) const;
+      /**
+       * @brief Checking if a ring is mapped
+       *
+       * @return `true` between `open()` and `close()`
+       */
+      bool is_open() const;
+      /**
+       * @brief Getting the sequence of the newest published frame, for polling
+       *
+       * @return The sequence or 0 if it is not open or nothing was published
+       */
+      std::uint64_t latest() const;
+      /**
+       * @brief Maps a ring read only
+       *
+       * @param name Specifies the name given to `shared_frame_ring::create()`
+       *
+       * @return `false` if it is already open, the object does not exist or it is
+       *         not a complete ring
+       */
+      bool open(const std::string &name);
+
+    private:
+      const shared_slot_header *slot(const std::uint64_t sequence) const;
+
+      const std::uint8_t *memory_;
+      std::size_t memory_size_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_SHARED_FRAME_RING_H
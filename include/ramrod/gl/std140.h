@@ -0,0 +1,398 @@
+#ifndef RAMROD_GL_STD140_H
+#define RAMROD_GL_STD140_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/shader.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Describes a member of a struct for `std140_layout`
+ *
+ * @param type   Specifies the struct
+ * @param member Specifies the member, named as in the GLSL block
+ */
+#define RAMROD_GL_STD140_MEMBER(type, member) \
+  ramrod::gl::std140_member<type, decltype(type::member), offsetof(type, member)>{&type::member, #member}
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Member of a block, made by `RAMROD_GL_STD140_MEMBER`
+     */
+    template<typename Class, typename Member, std::size_t Offset>
+    struct std140_member {
+      typedef Member type;
+      // offset of the member in the C++ struct
+      static constexpr std::size_t native_offset{Offset};
+
+      Member Class::*pointer;
+      const char *name;
+    };
+
+    /**
+     * @brief Lists the members of a struct mirrored by a GLSL uniform block
+     *
+     * Specialize it for every struct, in the order of the GLSL block:
+     *
+     *     template<> struct ramrod::gl::std140_layout<light> {
+     *       static constexpr auto members{std::make_tuple(
+     *         RAMROD_GL_STD140_MEMBER(light, position),
+     *         RAMROD_GL_STD140_MEMBER(light, intensity))};
+     *     };
+     */
+    template<typename T>
+    struct std140_layout;
+
+    namespace std140_detail {
+      constexpr std::size_t round_up(const std::size_t value, const std::size_t alignment){
+        return (value + alignment - 1) / alignment * alignment;
+      }
+
+      template<typename T, typename = void>
+      struct has_layout : std::false_type {};
+
+      template<typename T>
+      struct has_layout<T, std::void_t<decltype(std140_layout<T>::members)>> : std::true_type {};
+
+      template<typename T>
+      struct is_scalar : std::bool_constant<std::is_same_v<T, float> || std::is_same_v<T, double>
+                                            || std::is_same_v<T, std::int32_t>
+                                            || std::is_same_v<T, std::uint32_t>
+                                            || std::is_same_v<T, bool>> {};
+
+      // C arrays, and std::array except the vectors, which hold scalars
+      template<typename T>
+      struct array_element {
+        static constexpr bool value{false};
+      };
+
+      template<typename T, std::size_t N>
+      struct array_element<T[N]> {
+        static constexpr bool value{true};
+        typedef T type;
+      };
+
+      template<typename T, std::size_t N>
+      struct array_element<std::array<T, N>> {
+        static constexpr bool value{!is_scalar<T>::value};
+        typedef T type;
+      };
+    } // namespace: std140_detail
+
+    template<typename T, typename = void>
+    struct std140_type {
+      static constexpr bool supported{false};
+    };
+
+    /**
+     * @brief float, double, int, uint and bool, bool takes 4 bytes as in GLSL
+     */
+    template<typename T>
+    struct std140_type<T, std::enable_if_t<std140_detail::is_scalar<T>::value>> {
+      static constexpr bool supported{true};
+      static constexpr bool is_block{false};
+      static constexpr std::size_t alignment{std::is_same_v<T, double> ? 8 : 4};
+      static constexpr std::size_t size{alignment};
+      static constexpr bool is_native{!std::is_same_v<T, bool>};
+
+      static void write(const T &value, std::uint8_t *destination){
+        if constexpr(std::is_same_v<T, bool>){
+          const std::uint32_t word{value ? 1u : 0u};
+          std::memcpy(destination, &word, 4);
+        }else{
+          std::memcpy(destination, &value, size);
+        }
+      }
+    };
+
+    /**
+     * @brief std::array of 2, 3 or 4 scalars, the vectors vec2 to dvec4
+     */
+    template<typename T, std::size_t N>
+    struct std140_type<std::array<T, N>, std::enable_if_t<std140_detail::is_scalar<T>::value
+                                                          && N >= 2 && N <= 4>> {
+      static constexpr bool supported{true};
+      static constexpr bool is_block{false};
+      // a vec3 is aligned as a vec4
+      static constexpr std::size_t alignment{std140_type<T>::size * (N == 3 ? 4 : N)};
+      static constexpr std::size_t size{std140_type<T>::size * N};
+      static constexpr bool is_native{std140_type<T>::is_native};
+
+      static void write(const std::array<T, N> &value, std::uint8_t *destination){
+        for(std::size_t i = 0; i < N; ++i)
+          std140_type<T>::write(value[i], destination + i * std140_type<T>::size);
+      }
+    };
+
+    /**
+     * @brief Arrays of any supported type, and std::array of vectors, which are also
+     *        the column major matrices: `std::array<std::array<float, 4>, 4>` is a mat4
+     *
+     * Every element is aligned to 16 bytes.
+     */
+    template<typename T, std::size_t N>
+    struct std140_array {
+      static_assert(std140_type<T>::supported, "The element type has no std140 layout");
+
+      static constexpr bool supported{true};
+      static constexpr bool is_block{false};
+      static constexpr std::size_t alignment{std140_detail::round_up(std140_type<T>::alignment, 16)};
+      static constexpr std::size_t stride{std140_detail::round_up(std140_type<T>::size, alignment)};
+      static constexpr std::size_t size{stride * N};
+      static constexpr bool is_native{std140_type<T>::is_native && sizeof(T) == stride};
+
+      static void write(const T *value, std::uint8_t *destination){
+        for(std::size_t i = 0; i < N; ++i)
+          std140_type<T>::write(value[i], destination + i * stride);
+      }
+    };
+
+    template<typename T, std::size_t N>
+    struct std140_type<T[N]> : std140_array<T, N> {};
+
+    template<typename T, std::size_t N>
+    struct std140_type<std::array<T, N>, std::enable_if_t<!std140_detail::is_scalar<T>::value>> :
+      std140_array<T, N> {
+      static void write(const std::array<T, N> &value, std::uint8_t *destination){
+        std140_array<T, N>::write(value.data(), destination);
+      }
+    };
+
+    /**
+     * @brief Layout of a struct described by `std140_layout`, all computed at compile time
+     *
+     * `offset<I>()` is the std140 offset of member `I`. When the C++ struct already
+     * has the std140 offsets, `is_native` is `true` and `pack()` is a single memcpy;
+     * `static_assert(std140<T>::is_native)` guards a struct written to be uploaded
+     * as it is.
+     */
+    template<typename T>
+    class std140
+    {
+      static_assert(std140_detail::has_layout<T>::value,
+                    "Describe the members of the struct with std140_layout");
+
+      typedef std::remove_cv_t<decltype(std140_layout<T>::members)> members;
+
+      template<std::size_t I>
+      using member_type = typename std::tuple_element_t<I, members>::type;
+
+      template<std::size_t I>
+      static constexpr std::size_t member_offset(){
+        static_assert(std140_type<member_type<I>>::supported,
+                      "A member type has no std140 layout");
+        if constexpr(I == 0)
+          return 0;
+        else
+          return std140_detail::round_up(member_offset<I - 1>()
+                                         + std140_type<member_type<I - 1>>::size,
+                                         std140_type<member_type<I>>::alignment);
+      }
+
+      template<std::size_t... I>
+      static constexpr std::size_t max_alignment(std::index_sequence<I...>){
+        std::size_t maximum{16};
+        ((maximum = std140_type<member_type<I>>::alignment > maximum ?
+                    std140_type<member_type<I>>::alignment : maximum), ...);
+        return maximum;
+      }
+
+      template<std::size_t... I>
+      static constexpr bool native(std::index_sequence<I...>){
+        return ((member_offset<I>() == std::tuple_element_t<I, members>::native_offset
+                 && std140_type<member_type<I>>::is_native) && ...);
+      }
+
+    public:
+      static constexpr std::size_t count{std::tuple_size_v<members>};
+      static_assert(count > 0, "A block needs at least one member");
+
+      // the end of the last member
+      static constexpr std::size_t used_size{member_offset<count - 1>()
+                                             + std140_type<member_type<count - 1>>::size};
+      // a struct is aligned to 16 bytes and so is its size
+      static constexpr std::size_t alignment{max_alignment(std::make_index_sequence<count>())};
+      static constexpr std::size_t size{std140_detail::round_up(used_size, alignment)};
+      static constexpr bool is_native{native(std::make_index_sequence<count>())
+                                      && sizeof(T) >= used_size};
+
+      typedef std::array<std::uint8_t, size> image;
+
+      /**
+       * @brief Getting the std140 offset of a member
+       *
+       * @return Offset in bytes from the start of the block
+       */
+      template<std::size_t I>
+      static constexpr std::size_t offset(){
+        static_assert(I < count, "The block does not have that many members");
+        return member_offset<I>();
+      }
+      /**
+       * @brief Writes a value with the std140 layout, padding is zeroed
+       *
+       * @param value       Specifies the value
+       * @param destination Specifies where the `size` bytes are written
+       */
+      static void pack(const T &value, void *destination){
+        std::uint8_t *bytes{static_cast<std::uint8_t*>(destination)};
+        if constexpr(is_native){
+          std::memcpy(bytes, &value, used_size);
+        }else{
+          std::memset(bytes, 0, size);
+          pack_members(value, bytes, std::make_index_sequence<count>());
+        }
+        if constexpr(used_size < size)
+          std::memset(bytes + used_size, 0, size - used_size);
+      }
+      /**
+       * @brief Packs a value into a block image
+       *
+       * @param value Specifies the value
+       *
+       * @return The `size` bytes ready to be uploaded
+       */
+      static image packed(const T &value){
+        image result;
+        pack(value, result.data());
+        return result;
+      }
+      /**
+       * @brief Compares the layout with the one the driver gives to a uniform block
+       *
+       * Checks the data size given by `shader::uniform_block_data_size()` and the
+       * offsets and strides of the active members. Members are searched as
+       * `block_name.member` and then `member`, for blocks without instance name; nested
+       * structs and the first element of arrays of structs, C arrays or `std::array`,
+       * are checked too. Inactive members are skipped. It does nothing in release builds
+       * (NDEBUG).
+       *
+       * @param program    Specifies the linked shader
+       * @param block_name Specifies the name of the uniform block
+       *
+       * @return `false` if a size, offset or stride differs
+       */
+      static bool validate(const shader &program, const std::string &block_name){
+#ifdef NDEBUG
+        static_cast<void>(program);
+        static_cast<void>(block_name);
+        return true;
+#else
+        // drivers report the size with or without the padding to 16 bytes
+        const GLint data_size{program.uniform_block_data_size(block_name)};
+        if(data_size < static_cast<GLint>(used_size) || data_size > static_cast<GLint>(size))
+          return false;
+        return validate_members(program.id(), block_name + ".", 0);
+#endif
+      }
+      /**
+       * @brief Checks the active members of a struct inside a block
+       *
+       * Used by `validate()` and for nested structs.
+       *
+       * @param program Specifies the linked shader id
+       * @param prefix  Specifies the name prefix of the members, ending with '.'
+       * @param base    Specifies the offset of the struct inside the block
+       *
+       * @return `false` if an offset or stride differs
+       */
+      static bool validate_members(const GLuint program, const std::string &prefix,
+                                   const std::size_t base){
+        return validate_each(program, prefix, base, std::make_index_sequence<count>());
+      }
+
+    private:
+      template<std::size_t... I>
+      static void pack_members(const T &value, std::uint8_t *bytes, std::index_sequence<I...>){
+        (std140_type<member_type<I>>::write(value.*(std::get<I>(std140_layout<T>::members).pointer),
+                                             bytes + member_offset<I>()), ...);
+      }
+
+      template<std::size_t... I>
+      static bool validate_each(const GLuint program, const std::string &prefix,
+                                const std::size_t base, std::index_sequence<I...>){
+        return (validate_member<I>(program, prefix, base) && ...);
+      }
+
+      static GLint query(const GLuint program, const std::string &prefix, const std::string &name,
+                         const GLenum parameter){
+        const std::string qualified{prefix + name};
+        const GLchar *names[1]{qualified.c_str()};
+        GLuint index{GL_INVALID_INDEX};
+        glGetUniformIndices(program, 1, names, &index);
+        if(index == GL_INVALID_INDEX){
+          // a block without instance name does not prefix its members
+          const std::string::size_type dot{prefix.find('.')};
+          const std::string unqualified{qualified.substr(dot + 1)};
+          names[0] = unqualified.c_str();
+          glGetUniformIndices(program, 1, names, &index);
+          if(index == GL_INVALID_INDEX) return -1;
+        }
+
+        GLint value{-1};
+        glGetActiveUniformsiv(program, 1, &index, parameter, &value);
+        return value;
+      }
+
+      template<std::size_t I>
+      static bool validate_member(const GLuint program, const std::string &prefix,
+                                  const std::size_t base){
+        typedef member_type<I> type;
+        const std::string name{std::get<I>(std140_layout<T>::members).name};
+        const std::size_t expected{base + member_offset<I>()};
+
+        if constexpr(std140_detail::has_layout<type>::value){
+          return std140<type>::validate_members(program, prefix + name + ".", expected);
+        }else if constexpr(std140_detail::array_element<type>::value){
+          typedef typename std140_detail::array_element<type>::type element;
+          if constexpr(std140_detail::has_layout<element>::value){
+            return std140<element>::validate_members(program, prefix + name + "[0].", expected);
+          }else{
+            std::string uniform{name + "[0]"};
+            GLint offset{query(program, prefix, uniform, GL_UNIFORM_OFFSET)};
+            if(offset < 0){
+              // an array of vectors is also a matrix, which may have no element names
+              uniform = name;
+              offset = query(program, prefix, uniform, GL_UNIFORM_OFFSET);
+              if(offset < 0) return true;
+            }
+            GLint stride{query(program, prefix, uniform, GL_UNIFORM_ARRAY_STRIDE)};
+            if(stride == 0) stride = query(program, prefix, uniform, GL_UNIFORM_MATRIX_STRIDE);
+            return offset == static_cast<GLint>(expected)
+                && stride == static_cast<GLint>(std140_type<type>::stride);
+          }
+        }else{
+          const GLint offset{query(program, prefix, name, GL_UNIFORM_OFFSET)};
+          return offset < 0 || offset == static_cast<GLint>(expected);
+        }
+      }
+    };
+
+    /**
+     * @brief Structs with a `std140_layout` can be members of other blocks
+     */
+    template<typename T>
+    struct std140_type<T, std::enable_if_t<std140_detail::has_layout<T>::value>> {
+      static constexpr bool supported{true};
+      static constexpr bool is_block{true};
+      static constexpr std::size_t alignment{std140<T>::alignment};
+      static constexpr std::size_t size{std140<T>::size};
+      static constexpr bool is_native{std140<T>::is_native && sizeof(T) == size};
+
+      static void write(const T &value, std::uint8_t *destination){
+        std140<T>::pack(value, destination);
+      }
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_STD140_H
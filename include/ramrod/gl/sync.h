@@ -0,0 +1,165 @@
+#ifndef RAMROD_GL_SYNC_H
+#define RAMROD_GL_SYNC_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/enumerators.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Fence signaled once the GPU finished the commands issued before it
+     *
+     * Insert it after an upload, a draw or a read, then poll it with `is_signaled()`
+     * while doing other work, or wait with a timeout. Only the first `wait()` flushes
+     * the command stream, polling never does.
+     */
+    class sync
+    {
+    public:
+      /**
+       * @brief Creates a sync object
+       *
+       * @param insert Inserts the fence right away
+       */
+      sync(const bool insert = false);
+      sync(const sync &) = delete;
+      sync &operator=(const sync &) = delete;
+      ~sync();
+      /**
+       * @brief Deletes the fence
+       *
+       * @return `false` if there was no fence
+       */
+      bool delete_sync();
+      /**
+       * @brief Waits for the fence without timeout
+       *
+       * @return `true` if it is signaled or there is no fence, `false` if waiting failed
+       */
+      bool finish();
+      /**
+       * @brief Fence's id
+       *
+       * @return The fence or `nullptr` if none was inserted
+       */
+      GLsync id() const;
+      /**
+       * @brief Inserts a fence after the commands issued so far, replacing the previous one
+       *
+       * @return `false` if the fence could not be created
+       */
+      bool insert();
+      /**
+       * @brief Checking if a fence was inserted
+       *
+       * @return `true` between `insert()` and `delete_sync()`
+       */
+      bool is_created() const;
+      /**
+       * @brief Checking without flushing nor blocking if the fence was signaled
+       *
+       * The commands must have been flushed by a previous `wait()`, `glFlush()` or a
+       * buffer swap, otherwise the fence may never signal.
+       *
+       * @return `true` if it was signaled or there is no fence
+       */
+      bool is_signaled();
+      /**
+       * @brief Makes the GPU wait for the fence before the following commands, the
+       *        calling thread does not block
+       *
+       * Used to order commands between contexts sharing objects.
+       *
+       * @return `false` if there is no fence
+       */
+      bool server_wait();
+      /**
+       * @brief Waits for the fence, flushing the commands the first time
+       *
+       * @param timeout Specifies the nanoseconds to block, 0 only polls
+       *
+       * @return The status, `fence::status::none` if there is no fence
+       */
+      fence::status wait(const GLuint64 timeout = 0);
+
+    private:
+      GLsync id_;
+      bool flushed_, signaled_;
+    };
+
+    /**
+     * @brief Increasing points of the command stream, each one backed by a fence
+     *
+     * Insert a point after the work of a frame and later ask if it completed, instead
+     * of keeping one fence per resource. Fences signal in order, so a completed point
+     * completes every older one.
+     */
+    class fence_timeline
+    {
+    public:
+      fence_timeline();
+      ~fence_timeline();
+      /**
+       * @brief Deletes the fences of the points in flight, they count as completed
+       */
+      void clear();
+      /**
+       * @brief Polls without flushing the oldest points in flight
+       *
+       * @return The newest completed point, 0 if none
+       */
+      std::uint64_t completed();
+      /**
+       * @brief Inserts a point after the commands issued so far
+       *
+       * @return The point, starting at 1, or 0 if the fence could not be created
+       */
+      std::uint64_t insert();
+      /**
+       * @brief Checking without flushing if a point completed
+       *
+       * @param point Specifies a value returned by `insert()`
+       *
+       * @return `true` if the GPU finished the commands issued before it
+       */
+      bool is_complete(const std::uint64_t point);
+      /**
+       * @brief Getting the newest inserted point
+       *
+       * @return The point or 0 if none was inserted
+       */
+      std::uint64_t last() const;
+      /**
+       * @brief Getting the number of points in flight
+       *
+       * @return Points not known to be completed
+       */
+      std::size_t pending() const;
+      /**
+       * @brief Waits for a point, flushing the commands the first time
+       *
+       * @param point   Specifies a value returned by `insert()`
+       * @param timeout Specifies the nanoseconds to block, 0 only polls
+       *
+       * @return The status, `fence::status::none` if the point was never inserted
+       */
+      fence::status wait(const std::uint64_t point, const GLuint64 timeout = 0);
+
+    private:
+      struct entry {
+        std::uint64_t point;
+        sync fence;
+      };
+
+      std::deque<entry> in_flight_;
+      std::uint64_t last_, completed_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_SYNC_H
@@ -0,0 +1,309 @@
+#ifndef RAMROD_GL_TARGET_TEXTURE_H
+#define RAMROD_GL_TARGET_TEXTURE_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/texture.h"
+#include "ramrod/gl/texture_units.h"
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Texture whose target is fixed at compile time
+     *
+     * Allocation, sub-image upload and binding call the entry point of `Target`
+     * directly, without looking at `texture_target()`. Calling a function which does
+     * not exist for `Target` fails to compile. It can still be given to everything that
+     * takes a `texture`.
+     */
+    template<GLenum Target>
+    class target_texture : public texture
+    {
+    public:
+      static constexpr bool is_cube_map{Target == GL_TEXTURE_CUBE_MAP};
+      static constexpr bool is_multisample{Target == GL_TEXTURE_2D_MULTISAMPLE
+                                           || Target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY};
+      // number of coordinates given to glTexImage*D and glTexSubImage*D
+      static constexpr int dimensions{Target == GL_TEXTURE_1D ? 1 :
+                                      Target == GL_TEXTURE_3D || Target == GL_TEXTURE_2D_ARRAY
+                                      || Target == GL_TEXTURE_CUBE_MAP_ARRAY
+                                      || Target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY ? 3 : 2};
+
+      static_assert(Target == GL_TEXTURE_1D || Target == GL_TEXTURE_1D_ARRAY
+                    || Target == GL_TEXTURE_2D || Target == GL_TEXTURE_2D_ARRAY
+                    || Target == GL_TEXTURE_RECTANGLE || Target == GL_TEXTURE_3D
+                    || Target == GL_TEXTURE_CUBE_MAP || Target == GL_TEXTURE_CUBE_MAP_ARRAY
+                    || Target == GL_TEXTURE_2D_MULTISAMPLE
+                    || Target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY,
+                    "Unsupported texture target");
+
+      /**
+       * @brief Creates a texture object of `Target`
+       *
+       * @param create         Generates the texture right away
+       * @param active_texture Specifies the texture unit of this texture
+       * @param has_mipmap     Generates mipmaps when calling `parameter()`, multisample and
+       *                       rectangle textures do not have mipmaps
+       */
+      target_texture(const bool create = false, const GLuint active_texture = 0,
+                     const bool has_mipmap = !is_multisample && Target != GL_TEXTURE_RECTANGLE) :
+        texture(create, active_texture, has_mipmap, Target)
+      {}
+      /**
+       * @brief Specifies a texture image of any dimension
+       *
+       * A cube map receives the same data on its six faces, see `allocate_face()` to give
+       * each face its own data. `height` is the number of layers of a 1D array and
+       * `depth` the number of layers of a 2D array or the number of layer-faces of a cube
+       * map array (six per cube).
+       *
+       * @param width           Specifies the width of the texture image
+       * @param height          Specifies the height of the texture image, ignored by 1D
+       * @param depth           Specifies the depth of the texture image, only used by 3D
+       *                        and array targets
+       * @param texture_data    Specifies a pointer to the image data in memory
+       * @param data_format     Specifies the format of the pixel data
+       * @param data_type       Specifies the data type of the pixel data
+       * @param internal_format Specifies the number of color components in the texture
+       * @param level           Specifies the level-of-detail number
+       *
+       * @return `false` if the texture has not been generated yet
+       */
+      bool allocate(const GLsizei width, const GLsizei height = 1, const GLsizei depth = 1,
+                    const void *texture_data = nullptr, const GLenum data_format = GL_RGBA,
+                    const GLenum data_type = GL_UNSIGNED_BYTE,
+                    const GLint internal_format = GL_RGBA8, const GLint level = 0){
+        static_assert(!is_multisample,
+                      "Multisample textures are allocated with storage_multisample()");
+        if(id_ == 0) return false;
+
+        if constexpr(dimensions == 1){
+          glTexImage1D(Target, level, internal_format, width, 0,
+                       data_format, data_type, texture_data);
+        }else if constexpr(is_cube_map){
+          for(GLenum face = 0; face < 6; ++face)
+            glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, internal_format,
+                         width, height, 0, data_format, data_type, texture_data);
+        }else if constexpr(dimensions == 2){
+          glTexImage2D(Target, level, internal_format, width, height, 0,
+                       data_format, data_type, texture_data);
+        }else{
+          glTexImage3D(Target, level, internal_format, width, height, depth, 0,
+                       data_format, data_type, texture_data);
+        }
+
+        internal_format_ = internal_format;
+        data_type_ = data_type;
+        if(level == 0) base_size(width, height, depth);
+        return true;
+      }
+      /**
+       * @brief Specifies the image of one cube map face
+       *
+       * @param face            Specifies the face: GL_TEXTURE_CUBE_MAP_POSITIVE_X,
+       *                        GL_TEXTURE_CUBE_MAP_NEGATIVE_X, GL_TEXTURE_CUBE_MAP_POSITIVE_Y,
+       *                        GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, GL_TEXTURE_CUBE_MAP_POSITIVE_Z,
+       *                        or GL_TEXTURE_CUBE_MAP_NEGATIVE_Z.
+       * @param width           Specifies the width of the face, equal to its height
+       * @param height          Specifies the height of the face
+       * @param texture_data    Specifies a pointer to the image data in memory
+       * @param data_format     Specifies the format of the pixel data
+       * @param data_type       Specifies the data type of the pixel data
+       * @param internal_format Specifies the number of color components in the texture
+       * @param level           Specifies the level-of-detail number
+       *
+       * @return `false` if the texture has not been generated yet
+       */
+      bool allocate_face(const GLenum face, const GLsizei width, const GLsizei height,
+                         const void *texture_data = nullptr, const GLenum data_format = GL_RGBA,
+                         const GLenum data_type = GL_UNSIGNED_BYTE,
+                         const GLint internal_format = GL_RGBA8, const GLint level = 0){
+        static_assert(is_cube_map, "Only cube maps have faces");
+        if(id_ == 0) return false;
+
+        glTexImage2D(face, level, internal_format, width, height, 0,
+                     data_format, data_type, texture_data);
+        internal_format_ = internal_format;
+        data_type_ = data_type;
+        if(level == 0) base_size(width, height, 1);
+        return true;
+      }
+      /**
+       * @brief Specifies a sub-region of a texture image
+       *
+       * The region is a row range for 1D textures, a rectangle for 2D, 1D array and
+       * rectangle textures, and a box for 3D and array textures, where `z_offset` and
+       * `depth` select the layers. Cube maps are updated with `allocate_sub_face()`.
+       *
+       * @param width        Specifies the width of the region
+       * @param height       Specifies the height of the region
+       * @param depth        Specifies the depth of the region
+       * @param texture_data Specifies a pointer to the image data in memory
+       * @param x_offset     Specifies a texel offset in the x direction
+       * @param y_offset     Specifies a texel offset in the y direction
+       * @param z_offset     Specifies a texel offset in the z direction
+       * @param format       Specifies the format of the pixel data
+       * @param type         Specifies the data type of the pixel data
+       * @param level        Specifies the level-of-detail number
+       *
+       * @return `false` if the texture has not been generated yet
+       */
+      bool allocate_sub(const GLsizei width, const GLsizei height, const GLsizei depth,
+                        const void *texture_data, const GLint x_offset = 0,
+                        const GLint y_offset = 0, const GLint z_offset = 0,
+                        const GLenum format = GL_RGBA, const GLenum type = GL_UNSIGNED_BYTE,
+                        const GLint level = 0){
+        static_assert(!is_multisample, "Multisample textures cannot be uploaded");
+        static_assert(!is_cube_map, "Cube map faces are updated with allocate_sub_face()");
+        if(id_ == 0) return false;
+
+        if constexpr(dimensions == 1){
+          glTexSubImage1D(Target, level, x_offset, width, format, type, texture_data);
+        }else if constexpr(dimensions == 2){
+          glTexSubImage2D(Target, level, x_offset, y_offset, width, height,
+                          format, type, texture_data);
+        }else{
+          glTexSubImage3D(Target, level, x_offset, y_offset, z_offset, width, height, depth,
+                          format, type, texture_data);
+        }
+        return true;
+      }
+      /**
+       * @brief Specifies a sub-region of one cube map face
+       *
+       * @param face         Specifies the face, see `allocate_face()`
+       * @param width        Specifies the width of the region
+       * @param height       Specifies the height of the region
+       * @param texture_data Specifies a pointer to the image data in memory
+       * @param x_offset     Specifies a texel offset in the x direction
+       * @param y_offset     Specifies a texel offset in the y direction
+       * @param format       Specifies the format of the pixel data
+       * @param type         Specifies the data type of the pixel data
+       * @param level        Specifies the level-of-detail number
+       *
+       * @return `false` if the texture has not been generated yet
+       */
+      bool allocate_sub_face(const GLenum face, const GLsizei width, const GLsizei height,
+                             const void *texture_data, const GLint x_offset = 0,
+                             const GLint y_offset = 0, const GLenum format = GL_RGBA,
+                             const GLenum type = GL_UNSIGNED_BYTE, const GLint level = 0){
+        static_assert(is_cube_map, "Only cube maps have faces");
+        if(id_ == 0) return false;
+
+        glTexSubImage2D(face, level, x_offset, y_offset, width, height,
+                        format, type, texture_data);
+        return true;
+      }
+      // keeps bind(const sampler&) and the other overloads of texture
+      using texture::bind;
+      /**
+       * @brief Binds this texture to `Target` of the active unit
+       */
+      void bind(){
+        texture_units::current().bind<Target>(id_);
+      }
+      /**
+       * @brief Releases `Target` of the active unit
+       */
+      void release(){
+        texture_units::current().bind<Target>(0);
+      }
+      /**
+       * @brief Getting the number of samples per texel
+       *
+       * @return Samples given to `storage_multisample()` or 1
+       */
+      GLsizei samples(){
+        return samples_;
+      }
+      /**
+       * @brief Allocates immutable storage for all the levels at once
+       *
+       * The size cannot change afterwards, data is given with `allocate_sub()` or
+       * `allocate_sub_face()`.
+       *
+       * @param levels          Specifies the number of texture levels
+       * @param internal_format Specifies the sized internal format
+       * @param width           Specifies the width of the base level
+       * @param height          Specifies the height of the base level, ignored by 1D
+       * @param depth           Specifies the depth or layers of the base level, only used
+       *                        by 3D and array targets
+       *
+       * @return `false` if the texture has not been generated yet
+       */
+      bool storage(const GLsizei levels, const GLenum internal_format, const GLsizei width,
+                   const GLsizei height = 1, const GLsizei depth = 1){
+        static_assert(!is_multisample,
+                      "Multisample textures are allocated with storage_multisample()");
+        if(id_ == 0) return false;
+
+        if constexpr(dimensions == 1)
+          glTexStorage1D(Target, levels, internal_format, width);
+        else if constexpr(dimensions == 2)
+          glTexStorage2D(Target, levels, internal_format, width, height);
+        else
+          glTexStorage3D(Target, levels, internal_format, width, height, depth);
+
+        internal_format_ = static_cast<GLint>(internal_format);
+        has_mipmap_ = levels > 1;
+        base_size(width, height, depth);
+        return true;
+      }
+      /**
+       * @brief Allocates a multisample image
+       *
+       * @param samples                Specifies the number of samples
+       * @param internal_format        Specifies the sized internal format
+       * @param width                  Specifies the width of the image
+       * @param height                 Specifies the height of the image
+       * @param layers                 Specifies the number of layers of an array
+       * @param fixed_sample_locations Uses the same sample locations for every texel
+       *
+       * @return `false` if the texture has not been generated yet
+       */
+      bool storage_multisample(const GLsizei samples, const GLenum internal_format,
+                               const GLsizei width, const GLsizei height,
+                               const GLsizei layers = 1,
+                               const bool fixed_sample_locations = true){
+        static_assert(is_multisample, "Only multisample targets have samples");
+        if(id_ == 0) return false;
+
+        if constexpr(Target == GL_TEXTURE_2D_MULTISAMPLE)
+          glTexImage2DMultisample(Target, samples, internal_format, width, height,
+                                  fixed_sample_locations ? GL_TRUE : GL_FALSE);
+        else
+          glTexImage3DMultisample(Target, samples, internal_format, width, height, layers,
+                                  fixed_sample_locations ? GL_TRUE : GL_FALSE);
+
+        internal_format_ = static_cast<GLint>(internal_format);
+        samples_ = samples;
+        has_mipmap_ = false;
+        base_size(width, height, layers);
+        return true;
+      }
+
+    private:
+      void base_size(const GLsizei width, const GLsizei height, const GLsizei depth){
+        width_ = width;
+        height_ = dimensions == 1 ? 1 : height;
+        if constexpr(is_cube_map)
+          depth_ = 6;
+        else
+          depth_ = dimensions == 3 ? depth : 1;
+      }
+    };
+
+    typedef target_texture<GL_TEXTURE_1D> texture_1d;
+    typedef target_texture<GL_TEXTURE_1D_ARRAY> texture_1d_array;
+    typedef target_texture<GL_TEXTURE_2D> texture_2d;
+    typedef target_texture<GL_TEXTURE_2D_ARRAY> texture_2d_array;
+    typedef target_texture<GL_TEXTURE_2D_MULTISAMPLE> texture_2d_multisample;
+    typedef target_texture<GL_TEXTURE_2D_MULTISAMPLE_ARRAY> texture_2d_multisample_array;
+    typedef target_texture<GL_TEXTURE_3D> texture_3d;
+    typedef target_texture<GL_TEXTURE_CUBE_MAP> texture_cube_map;
+    typedef target_texture<GL_TEXTURE_CUBE_MAP_ARRAY> texture_cube_map_array;
+    typedef target_texture<GL_TEXTURE_RECTANGLE> texture_rectangle;
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_TARGET_TEXTURE_H
@@ -3,9 +3,14 @@
 
 // OpenGL loader and core library
 #include "glad/glad.h"
+#include "ramrod/gl/sync.h"
+
+#include <cstddef>
 
 namespace ramrod{
   namespace gl {
+    class sampler;
+
     class texture
     {
     public:
@@ -77,7 +82,9 @@ namespace ramrod{
       /**
        * @brief Specify a two-dimensional texture image
        *
-       * It does automatically selects the data and internal format
+       * It does automatically selects the data and internal format. Three components
+       * data from client memory is expanded to RGBA before uploading it, the internal
+       * format stays GL_RGB8.
        *
        * @param width          Specifies the width of the texture image.
        * @param height         Specifies the height of the texture image
@@ -88,6 +95,25 @@ namespace ramrod{
        */
       bool allocate(const GLsizei width, const GLsizei height, const void *texture_data,
                     const int component_size);
+      /**
+       * @brief Specify a two-dimensional texture image in a compressed format
+       *
+       * @param width           Specifies the width of the texture image.
+       * @param height          Specifies the height of the texture image
+       * @param texture_data    Specifies a pointer to the compressed image data in memory.
+       * @param size_in_bytes   Specifies the number of unsigned bytes of image data starting
+       *                        at the address specified by `texture_data`.
+       * @param internal_format Specifies the format of the compressed image data, e.g.
+       *                        GL_COMPRESSED_RED_RGTC1, GL_COMPRESSED_RG_RGTC2 or
+       *                        GL_COMPRESSED_RGBA_BPTC_UNORM.
+       * @param level           Specifies the level-of-detail number. Level 0 is the base image
+       *                        level. Level n is the nth mipmap reduction image.
+       *
+       * @return `false` if the texture has not been generated yet
+       */
+      bool allocate_compressed(const GLsizei width, const GLsizei height,
+                               const void *texture_data, const GLsizei size_in_bytes,
+                               const GLenum internal_format, const GLint level = 0);
       /**
        * @brief Specify a two-dimensional texture subimage
        *
@@ -122,12 +148,40 @@ namespace ramrod{
        * @brief Binds this named texture to a texturing target
        */
       void bind();
+      /**
+       * @brief Binds this named texture and a shared sampler to this texture's unit
+       *
+       * The sampler state overrides this texture's own parameters while it stays bound,
+       * so the same texture can be sampled differently on different units. The unit
+       * must be active, see `activate()`.
+       *
+       * @param shared_sampler Specifies the sampler bound to this texture's active unit
+       */
+      void bind(const sampler &shared_sampler);
+      /**
+       * @brief Binds this named texture to any unit of the current `texture_units` table
+       *
+       * The texture is kept on the unit where it is already resident or replaces the
+       * least recently used one, the returned unit becomes this texture's unit and is
+       * the value to give to the shader's sampler uniform. The unit is not necessarily
+       * active after this call.
+       *
+       * @return The unit where this texture is bound
+       */
+      GLuint bind_resident();
       /**
        * @brief Deletes this named texture
        *
        * @return `false` if the texture has not been generated yet
        */
       bool delete_texture();
+      /**
+       * @brief Getting the depth or number of layers of the base level
+       *
+       * @return Depth of a 3D texture, layers of an array texture, 6 for a cube map,
+       *         or 1 otherwise
+       */
+      GLsizei depth();
       /**
        * @brief generate
        *
@@ -140,18 +194,62 @@ namespace ramrod{
        * @return `false` if the texture has not been generated yet
        */
       bool generate_mipmap();
+      /**
+       * @brief Reads a level back once the GPU finished writing it, instead of blocking
+       *        inside the driver
+       *
+       * The texture must be bound. With a pixel pack buffer bound, `pixels` is an offset
+       * into it.
+       *
+       * @param ready   Specifies the fence inserted after the commands writing the texture
+       * @param pixels  Returns the texels
+       * @param format  Specifies the format of the pixel data
+       * @param type    Specifies the data type of the pixel data
+       * @param level   Specifies the level-of-detail number
+       * @param timeout Specifies the nanoseconds to wait for the fence, 0 only polls
+       *
+       * @return `false` if the fence is not signaled yet, waiting failed or the texture
+       *         has not been generated yet
+       */
+      bool get_image_when_ready(sync &ready, void *pixels, const GLenum format,
+                                const GLenum type, const GLint level = 0,
+                                const GLuint64 timeout = 0);
+      /**
+       * @brief Getting the height of the base level
+       *
+       * @return Height in pixels given to the last level 0 allocation
+       */
+      GLsizei height();
       /**
        * @brief Obtaining the texture name
        *
        * @return The texture's name
        */
       GLuint id();
+      /**
+       * @brief Getting this texture's internal format
+       *
+       * @return The internal format given to the last allocation
+       */
+      GLint internal_format();
       /**
        * @brief Changing this texture's internal format
        *
        * @param new_internal_format Specifies the number of color components in the texture.
        */
       void internal_format(const GLint new_internal_format);
+      /**
+       * @brief Telling the driver that the content of a level is no longer needed
+       *
+       * The next writes do not have to preserve the old texels, which saves memory
+       * bandwidth on tiled and integrated GPUs. It does nothing when GL_ARB_invalidate_subdata
+       * is not available.
+       *
+       * @param level Specifies the level-of-detail number
+       *
+       * @return `false` if the texture has not been generated yet
+       */
+      bool invalidate(const GLint level = 0);
       /**
        * @brief Obtaining this texture's maximum anisotropy filter
        *
@@ -164,6 +262,16 @@ namespace ramrod{
        * @param new_max_filtering new maximum anisotropy filter value
        */
       void max_anisotropic_filtering(const GLfloat new_max_filtering);
+      /**
+       * @brief Estimating the video memory used by this texture
+       *
+       * The estimation uses the internal format, the size, depth and samples of the base
+       * level and the full mipmap chain if this texture generates mipmaps. Three components formats
+       * are counted as padded to four components like most drivers store them.
+       *
+       * @return Size in bytes or 0 if the texture has not been allocated yet
+       */
+      std::size_t memory_size();
       /**
        * @brief Indicates if this texture is generating mipmaps
        *
@@ -253,6 +361,12 @@ namespace ramrod{
        * @param new_texture_target Specifies the target to which the texture is bound
        */
       void texture_target(const GLenum new_texture_target);
+      /**
+       * @brief Getting the width of the base level
+       *
+       * @return Width in pixels given to the last level 0 allocation
+       */
+      GLsizei width();
       /**
        * @brief Setting a global texture's maximum anisotropy filter
        *
@@ -263,9 +377,10 @@ namespace ramrod{
        */
       static bool set_max_filtering(const GLfloat max_filtering);
 
-    private:
+    protected:
       GLuint id_;
       GLuint active_texture_;
+      GLsizei width_, height_, depth_, samples_;
       GLenum data_type_, texture_target_;
       GLint internal_format_;
       GLfloat max_filtering_;
@@ -0,0 +1,176 @@
+#ifndef RAMROD_GL_TEXTURE_RESIDENCY_H
+#define RAMROD_GL_TEXTURE_RESIDENCY_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/enumerators.h"
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+namespace ramrod {
+  namespace gl {
+    class texture;
+
+    struct residency_statistics {
+      std::size_t hits{0};
+      std::size_t misses{0};
+      std::size_t evictions{0};
+      std::size_t mip_drops{0};
+      std::size_t restores{0};
+      std::size_t bytes_resident{0};
+      std::size_t textures_resident{0};
+    };
+
+    class texture_residency
+    {
+    public:
+      /**
+       * @brief Function that uploads a texture's data again
+       *
+       * It receives a generated and bound texture and must allocate its data and set its
+       * parameters. `dropped_levels` indicates how many top mipmap levels to skip, the
+       * base level to upload is then `dropped_levels` times smaller than the original.
+       * It returns `false` if the data could not be loaded.
+       */
+      typedef std::function<bool(texture &target, const GLint dropped_levels)> reload_callback;
+
+      /**
+       * @brief Creates a residency manager
+       *
+       * @param budget_in_bytes Specifies the maximum estimated video memory for all the
+       *                        textures managed by this object.
+       * @param policy          Specifies what happens to the least recently bound texture
+       *                        when the budget is exceeded: `release` deletes it and
+       *                        `drop_mip` reloads it with half its resolution.
+       */
+      texture_residency(const std::size_t budget_in_bytes,
+                        const residency::policy policy = residency::policy::release);
+      ~texture_residency();
+      /**
+       * @brief Starts managing a texture
+       *
+       * A texture which already has data is counted as resident, otherwise it will be
+       * loaded the first time it is bound. The texture must outlive its registration,
+       * see `remove()`.
+       *
+       * @param target Specifies the managed texture
+       * @param reload Specifies the function used to load the texture's data on demand
+       *
+       * @return `false` if the texture was already managed or `reload` is empty
+       */
+      bool add(texture &target, const reload_callback &reload);
+      /**
+       * @brief Binds a managed texture, loading it if it was evicted
+       *
+       * This marks the texture as the most recently used one and may evict the least
+       * recently used textures to stay within budget; `drop_mip` reloads them on the
+       * active unit and binds `target` back afterwards.
+       *
+       * @param target Specifies the managed texture
+       *
+       * @return `false` if the texture is not managed or could not be loaded
+       */
+      bool bind(texture &target);
+      /**
+       * @brief Getting the video memory budget
+       *
+       * @return Budget in bytes
+       */
+      std::size_t budget() const;
+      /**
+       * @brief Setting the video memory budget, textures are evicted right away if needed
+       *
+       * @param new_budget_in_bytes Specifies the new budget in bytes
+       */
+      void budget(const std::size_t new_budget_in_bytes);
+      /**
+       * @brief Checking if a texture is managed by this object
+       *
+       * @param target Specifies the texture
+       *
+       * @return `true` if the texture was added and not removed
+       */
+      bool contains(const texture &target) const;
+      /**
+       * @brief Getting how many top mipmap levels a texture has lost
+       *
+       * @param target Specifies the managed texture
+       *
+       * @return Number of dropped levels or -1 if the texture is not managed
+       */
+      GLint dropped_levels(const texture &target) const;
+      /**
+       * @brief Evicts least recently used textures
+       *
+       * @param bytes Specifies the minimum amount of estimated video memory to free
+       *
+       * @return Amount of bytes actually freed
+       */
+      std::size_t evict(const std::size_t bytes);
+      /**
+       * @brief Checking if a managed texture has its data in video memory
+       *
+       * @param target Specifies the managed texture
+       *
+       * @return `false` if the texture was evicted or is not managed
+       */
+      bool is_resident(const texture &target) const;
+      /**
+       * @brief Getting the eviction policy
+       *
+       * @return Current eviction policy
+       */
+      residency::policy policy() const;
+      /**
+       * @brief Setting the eviction policy
+       *
+       * @param new_policy Specifies the new eviction policy
+       */
+      void policy(const residency::policy new_policy);
+      /**
+       * @brief Stops managing a texture, its data is left untouched
+       *
+       * @param target Specifies the managed texture
+       *
+       * @return `false` if the texture was not managed
+       */
+      bool remove(const texture &target);
+      /**
+       * @brief Resets the hit, miss, eviction, drop and restore counters
+       */
+      void reset_statistics();
+      /**
+       * @brief Getting the residency counters
+       *
+       * @return Statistics since the creation or the last `reset_statistics()`
+       */
+      const residency_statistics &statistics() const;
+
+    private:
+      struct entry {
+        texture *target;
+        reload_callback reload;
+        std::size_t bytes;
+        GLint dropped_levels;
+        bool resident;
+        std::list<texture*>::iterator position;
+      };
+
+      void enforce(const texture *keep);
+      bool evict_one(const texture *keep);
+      bool load(entry &item, const bool most_recent);
+      void unlink(entry &item);
+
+      std::unordered_map<const texture*, entry> entries_;
+      std::list<texture*> recent_;
+      std::size_t budget_;
+      residency::policy policy_;
+      residency_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_TEXTURE_RESIDENCY_H
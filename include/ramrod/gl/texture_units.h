@@ -0,0 +1,204 @@
+#ifndef RAMROD_GL_TEXTURE_UNITS_H
+#define RAMROD_GL_TEXTURE_UNITS_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Shadow copy of the texture unit bindings of one OpenGL context
+     *
+     * Remembers the active unit, and the texture and sampler bound to every unit, so
+     * redundant `glActiveTexture`, `glBindTexture` and `glBindSampler` calls are skipped.
+     * `texture` and `sampler` objects go through the table made current for the calling
+     * thread; bindings changed by calling OpenGL directly must be followed by
+     * `invalidate()`.
+     */
+    class texture_units
+    {
+    public:
+      /**
+       * @brief Creates an empty table, every binding is unknown until first used
+       */
+      texture_units();
+      ~texture_units();
+      /**
+       * @brief Makes a texture resident on any unit of the least-recently-used range
+       *
+       * If the texture is already bound to a unit of the range no OpenGL call is issued,
+       * otherwise it replaces the texture of the least recently used unit.
+       *
+       * @param target     Specifies the target to which the texture is bound
+       * @param texture_id Specifies the name of the texture
+       *
+       * @return The unit where the texture is bound
+       */
+      GLuint acquire(const GLenum target, const GLuint texture_id);
+      /**
+       * @brief Selects the active texture unit
+       *
+       * @param unit Specifies which texture unit to make active, integer starting from 0
+       *
+       * @return `false` if the unit was already active and the call was skipped
+       */
+      bool activate(const GLuint unit);
+      /**
+       * @brief Getting the active texture unit
+       *
+       * @return Active unit or `GL_INVALID_INDEX` if it is unknown
+       */
+      GLuint active_unit() const;
+      /**
+       * @brief Binds a texture to the active unit
+       *
+       * @param target     Specifies the target to which the texture is bound
+       * @param texture_id Specifies the name of the texture, 0 releases the target
+       *
+       * @return `false` if the texture was already bound and the call was skipped
+       */
+      bool bind(const GLenum target, const GLuint texture_id);
+      /**
+       * @brief Activates a unit and binds a texture to it
+       *
+       * @param unit       Specifies the texture unit, integer starting from 0
+       * @param target     Specifies the target to which the texture is bound
+       * @param texture_id Specifies the name of the texture, 0 releases the target
+       *
+       * @return `false` if the texture was already bound and the call was skipped
+       */
+      bool bind(const GLuint unit, const GLenum target, const GLuint texture_id);
+      /**
+       * @brief Binds a texture to the active unit, the target is resolved at compile time
+       *
+       * Used by `target_texture`, the binding slot of `Target` is a constant so no
+       * target lookup happens when binding.
+       *
+       * @param texture_id Specifies the name of the texture, 0 releases the target
+       *
+       * @return `false` if the texture was already bound and the call was skipped
+       */
+      template<GLenum Target>
+      bool bind(const GLuint texture_id){
+        constexpr int index{target_index(Target)};
+        static_assert(index >= 0, "Unsupported texture target");
+        return bind_slot(Target, index, texture_id);
+      }
+      /**
+       * @brief Binds a sampler to a unit
+       *
+       * @param unit       Specifies the texture unit, integer starting from 0
+       * @param sampler_id Specifies the name of the sampler, 0 releases the unit's sampler
+       *
+       * @return `false` if the sampler was already bound and the call was skipped
+       */
+      bool bind_sampler(const GLuint unit, const GLuint sampler_id);
+      /**
+       * @brief Getting the texture bound to a unit
+       *
+       * @param unit   Specifies the texture unit, integer starting from 0
+       * @param target Specifies the texture target
+       *
+       * @return Texture name or `GL_INVALID_INDEX` if it is unknown
+       */
+      GLuint bound(const GLuint unit, const GLenum target) const;
+      /**
+       * @brief Removes a deleted sampler from every unit
+       *
+       * @param sampler_id Specifies the name of the deleted sampler
+       */
+      void forget_sampler(const GLuint sampler_id);
+      /**
+       * @brief Removes a deleted texture from every unit
+       *
+       * @param texture_id Specifies the name of the deleted texture
+       */
+      void forget_texture(const GLuint texture_id);
+      /**
+       * @brief Marks every binding as unknown, the next bind calls will be issued
+       */
+      void invalidate();
+      /**
+       * @brief Selecting the units managed by `acquire()`
+       *
+       * Units outside of the range are left for explicit binding.
+       *
+       * @param first_unit Specifies the first unit of the range
+       * @param count      Specifies the number of units, 0 uses every unit after `first_unit`
+       */
+      void lru_range(const GLuint first_unit, const GLuint count = 0);
+      /**
+       * @brief Getting the number of skipped OpenGL calls
+       *
+       * @return Number of redundant calls avoided since this table was created
+       */
+      std::size_t redundant_calls() const;
+      /**
+       * @brief Getting the number of texture image units of the context
+       *
+       * @return Value of `GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS` or 0 if not queried yet
+       */
+      GLuint unit_count() const;
+      /**
+       * @brief Getting the table used by the calling thread
+       *
+       * Every thread has its own default table which is used until `make_current()`
+       * selects a different one.
+       *
+       * @return Current table
+       */
+      static texture_units &current();
+      /**
+       * @brief Selecting the table used by the calling thread
+       *
+       * Call it whenever the thread makes a different OpenGL context current.
+       *
+       * @param table Specifies the context's table, `nullptr` selects the thread's default
+       */
+      static void make_current(texture_units *table);
+      /**
+       * @brief Getting the position of a target in the binding table
+       *
+       * @param target Specifies the texture target
+       *
+       * @return Index of the target or -1 if it is not tracked
+       */
+      static constexpr int target_index(const GLenum target){
+        switch(target){
+          case GL_TEXTURE_1D: return 0;
+          case GL_TEXTURE_2D: return 1;
+          case GL_TEXTURE_3D: return 2;
+          case GL_TEXTURE_1D_ARRAY: return 3;
+          case GL_TEXTURE_2D_ARRAY: return 4;
+          case GL_TEXTURE_RECTANGLE: return 5;
+          case GL_TEXTURE_CUBE_MAP: return 6;
+          case GL_TEXTURE_CUBE_MAP_ARRAY: return 7;
+          case GL_TEXTURE_BUFFER: return 8;
+          case GL_TEXTURE_2D_MULTISAMPLE: return 9;
+          case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 10;
+          default: return -1;
+        }
+      }
+
+    private:
+      bool bind_slot(const GLenum target, const int index, const GLuint texture_id);
+      bool initialize();
+      std::size_t slot(const GLuint unit, const int target_index) const;
+
+      std::vector<GLuint> textures_;
+      std::vector<GLuint> samplers_;
+      std::vector<std::uint64_t> last_use_;
+      GLuint active_, units_, lru_first_, lru_count_;
+      std::uint64_t clock_;
+      std::size_t redundant_;
+
+      static thread_local texture_units *current_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_TEXTURE_UNITS_H
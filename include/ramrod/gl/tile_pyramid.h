@@ -0,0 +1,144 @@
+#ifndef RAMROD_GL_TILE_PYRAMID_H
+#define RAMROD_GL_TILE_PYRAMID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Header at the beginning of a tile pyramid file
+     *
+     * All the values are little endian and the header is 56 bytes long. It is followed
+     * by a table of 64 bits offsets, one per tile: first every tile of level 0 in
+     * row-major order, then level 1, and so on. An offset of 0 marks a missing tile. Every stored tile has
+     * `bytes_per_tile` bytes: `tile_size + 2 * border` rows of pixels, top row first,
+     * ready to be given to `glTexSubImage2D` with `format` and `type`.
+     */
+    struct tile_pyramid_header {
+      char magic[8]{'R', 'R', 'G', 'L', 'V', 'T', 'P', '1'};
+      std::uint32_t width{0};
+      std::uint32_t height{0};
+      std::uint32_t tile_size{0};
+      std::uint32_t border{0};
+      std::uint32_t levels{0};
+      std::uint32_t internal_format{0};
+      std::uint32_t format{0};
+      std::uint32_t type{0};
+      std::uint32_t bytes_per_tile{0};
+      std::uint32_t reserved[3]{0, 0, 0};
+    };
+
+    class tile_pyramid
+    {
+    public:
+      /**
+       * @brief Function that fills one tile while writing a pyramid file
+       *
+       * It receives the level and tile coordinates and a buffer of `bytes_per_tile`
+       * bytes, and returns `false` to leave the tile missing.
+       */
+      typedef std::function<bool(const std::uint32_t level, const std::uint32_t x,
+                                 const std::uint32_t y, void *tile)> tile_writer;
+
+      tile_pyramid();
+      /**
+       * @brief Unmaps the file if it is open
+       */
+      ~tile_pyramid();
+      /**
+       * @brief Unmaps the file
+       *
+       * @return `false` if no file was open
+       */
+      bool close();
+      /**
+       * @brief Getting the file's header
+       *
+       * @return Header of the open file
+       */
+      const tile_pyramid_header &header() const;
+      /**
+       * @brief Checking if a file is mapped
+       *
+       * @return `true` if `open()` succeeded and `close()` has not been called
+       */
+      bool is_open() const;
+      /**
+       * @brief Maps a tile pyramid file into memory
+       *
+       * Tiles are read directly from the mapping, the operating system pages them in
+       * on first access and can drop them under memory pressure. On Windows the whole
+       * file is read into memory instead.
+       *
+       * @param path Specifies the file's path
+       *
+       * @return `false` if the file could not be mapped or is not a valid tile pyramid
+       */
+      bool open(const std::string &path);
+      /**
+       * @brief Asks the operating system to read a tile ahead of its use
+       *
+       * @param level Specifies the mipmap level of the tile
+       * @param x     Specifies the tile column
+       * @param y     Specifies the tile row
+       */
+      void prefetch(const std::uint32_t level, const std::uint32_t x, const std::uint32_t y) const;
+      /**
+       * @brief Getting a tile's data
+       *
+       * @param level Specifies the mipmap level of the tile
+       * @param x     Specifies the tile column
+       * @param y     Specifies the tile row
+       *
+       * @return Pointer to `bytes_per_tile` bytes or `nullptr` if the tile is missing
+       */
+      const void *tile(const std::uint32_t level, const std::uint32_t x,
+                       const std::uint32_t y) const;
+      /**
+       * @brief Getting the number of tile columns of a level
+       *
+       * @param level Specifies the mipmap level
+       *
+       * @return Number of columns or 0 if the level does not exist
+       */
+      std::uint32_t tiles_x(const std::uint32_t level) const;
+      /**
+       * @brief Getting the number of tile rows of a level
+       *
+       * @param level Specifies the mipmap level
+       *
+       * @return Number of rows or 0 if the level does not exist
+       */
+      std::uint32_t tiles_y(const std::uint32_t level) const;
+      /**
+       * @brief Writes a tile pyramid file
+       *
+       * @param path   Specifies the file's path
+       * @param header Specifies the pyramid's description, the magic value is overwritten
+       * @param fill   Specifies the function that generates every tile
+       *
+       * @return `false` if the header is invalid or the file could not be written
+       */
+      static bool write(const std::string &path, const tile_pyramid_header &header,
+                        const tile_writer &fill);
+
+    private:
+      std::size_t tile_index(const std::uint32_t level, const std::uint32_t x,
+                             const std::uint32_t y) const;
+
+      tile_pyramid_header header_;
+      const unsigned char *map_;
+      std::size_t size_;
+      const std::uint64_t *offsets_;
+      std::vector<std::size_t> level_start_;
+      // the file's data where it is read instead of mapped
+      std::vector<unsigned char> contents_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_TILE_PYRAMID_H
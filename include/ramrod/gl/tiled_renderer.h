@@ -0,0 +1,155 @@
+#ifndef RAMROD_GL_TILED_RENDERER_H
+#define RAMROD_GL_TILED_RENDERER_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/readback_queue.h"
+#include "ramrod/gl/render_target_pool.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <string>
+
+namespace ramrod {
+  namespace gl {
+    struct image_tile {
+      // row 0 is the top row of tiles
+      std::size_t column{0};
+      std::size_t row{0};
+      // bottom left corner inside the image, in OpenGL pixels (y goes up)
+      GLint x{0};
+      GLint y{0};
+      GLsizei width{0};
+      GLsizei height{0};
+      // column-major matrix multiplied on the left of the projection matrix, it maps the
+      // tile to the whole viewport
+      std::array<GLfloat, 16> projection{};
+    };
+
+    struct tiled_statistics {
+      std::size_t tiles{0};
+      std::size_t written_bytes{0};
+      // tiles that waited for the GPU because every readback slot was busy
+      std::size_t stalls{0};
+    };
+
+    /**
+     * @brief Renders images larger than the biggest frame buffer, one tile at a time
+     *
+     * Every tile is drawn into the same pooled frame buffer with the projection offset
+     * of `image_tile::projection`, then read back asynchronously and written at its
+     * place in the output file, so only the tiles in flight are kept in memory whatever
+     * the size of the image. The file is a PAM image (RGBA, rows from the top) or the
+     * same pixels without header:
+     *
+     *   image_tile tile;
+     *   renderer.begin("map.pam", 32768, 32768);
+     *   while(renderer.next(tile)){
+     *     // clear, then draw with tile.projection * projection
+     *   }
+     *   renderer.end();
+     *
+     * `render_target_pool::end_frame()` must not be called between `begin()` and `end()`.
+     */
+    class tiled_renderer
+    {
+    public:
+      /**
+       * @brief Creates a renderer, the targets are acquired by `begin()`
+       *
+       * @param pool      Specifies where the color and depth targets are acquired
+       * @param tile_size Specifies the width and height of the tiles, 0 uses the biggest
+       *                  render buffer up to 2048
+       * @param slots     Specifies the number of tiles read back at the same time
+       */
+      tiled_renderer(render_target_pool &pool, const GLsizei tile_size = 0,
+                     const std::size_t slots = 3);
+      ~tiled_renderer();
+      /**
+       * @brief Creates the output file and acquires the targets
+       *
+       * @param path   Specifies the file path
+       * @param width  Specifies the width of the image
+       * @param height Specifies the height of the image
+       * @param header Writes a PAM header, otherwise only the pixels
+       *
+       * @return `false` if it already began, the size is not valid or the file or the
+       *         frame buffer cannot be created
+       */
+      bool begin(const std::string &path, const GLsizei width, const GLsizei height,
+                 const bool header = true);
+      /**
+       * @brief Getting the number of tiles per row
+       *
+       * @return Columns of the image being rendered
+       */
+      std::size_t columns() const;
+      /**
+       * @brief Writes the tiles in flight, closes the file and releases the targets
+       *
+       * @return `false` if it did not begin, a tile was not rendered or writing failed
+       */
+      bool end();
+      /**
+       * @brief Reads the tile just drawn and prepares the next one
+       *
+       * Binds the frame buffer and sets the viewport to the size of the tile. The frame
+       * buffer binding and viewport of `begin()` are restored after the last tile.
+       *
+       * @param tile Returns the tile to draw
+       *
+       * @return `false` when every tile was drawn or writing failed
+       */
+      bool next(image_tile &tile);
+      /**
+       * @brief Getting the number of tile rows
+       *
+       * @return Rows of the image being rendered
+       */
+      std::size_t rows() const;
+      /**
+       * @brief Getting the counters of the current or last image
+       *
+       * @return Tiles, bytes written and stalls
+       */
+      const tiled_statistics &statistics() const;
+      /**
+       * @brief Getting the size of the tiles
+       *
+       * @return Width and height of the tiles in pixels
+       */
+      GLsizei tile_size() const;
+
+    private:
+      struct pending {
+        std::uint64_t ticket;
+        image_tile tile;
+      };
+
+      image_tile layout(const std::size_t index) const;
+      void restore();
+      bool write(const pending &item);
+      bool write_ready(const bool wait);
+
+      render_target_pool &pool_;
+      readback_queue readbacks_;
+      std::size_t slots_;
+      std::deque<pending> pending_;
+      render_target *color_, *depth_;
+      frame_buffer *frame_;
+      std::FILE *file_;
+      long long header_bytes_;
+      GLsizei requested_size_, tile_size_, width_, height_;
+      std::size_t columns_, rows_, index_;
+      GLint previous_frame_buffer_;
+      GLint previous_viewport_[4];
+      bool drawing_, failed_;
+      tiled_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_TILED_RENDERER_H
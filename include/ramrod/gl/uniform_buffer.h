@@ -2,6 +2,7 @@
 #define RAMROD_GL_UNIFORM_BUFFER_H
 
 #include "glad/glad.h"
+#include "ramrod/gl/std140.h"
 
 namespace ramrod {
   namespace gl {
@@ -49,6 +50,44 @@ namespace ramrod {
        */
       bool allocate_section(const GLvoid *data, const GLsizeiptr size_in_bytes,
                             const GLintptr offset = 0);
+      /**
+       * @brief Allocating a `GL_UNIFORM_BUFFER` with a block described by `std140_layout`
+       *
+       * The value is packed with the std140 layout and uploaded with a single copy.
+       *
+       * @param block Specifies the value of the uniform block
+       * @param ussage Specifies the expected usage pattern of the data store
+       *
+       * @returns `false` if `generate()` has not been called
+       */
+      template<typename T>
+      bool allocate_block(const T &block, const GLenum ussage = GL_DYNAMIC_DRAW){
+        if constexpr(std140<T>::is_native && sizeof(T) >= std140<T>::size){
+          return allocate(&block, static_cast<GLsizei>(std140<T>::size), ussage);
+        }else{
+          const typename std140<T>::image packed{std140<T>::packed(block)};
+          return allocate(packed.data(), static_cast<GLsizei>(packed.size()), ussage);
+        }
+      }
+      /**
+       * @brief Allocating a section of a `GL_UNIFORM_BUFFER` with a block described
+       *        by `std140_layout`
+       *
+       * @param block Specifies the value of the uniform block
+       * @param offset Specifies the offset into the buffer object's data store, it must be
+       *               a multiple of `GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT` to be bound
+       *
+       * @returns `false` if `generate()` has not been called
+       */
+      template<typename T>
+      bool allocate_block_section(const T &block, const GLintptr offset = 0){
+        if constexpr(std140<T>::is_native && sizeof(T) >= std140<T>::size){
+          return allocate_section(&block, static_cast<GLsizeiptr>(std140<T>::size), offset);
+        }else{
+          const typename std140<T>::image packed{std140<T>::packed(block)};
+          return allocate_section(packed.data(), static_cast<GLsizeiptr>(packed.size()), offset);
+        }
+      }
       /**
        * @brief Binds this buffer's `GL_UNIFORM_BUFFER`
        */
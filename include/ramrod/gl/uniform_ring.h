@@ -0,0 +1,198 @@
+#ifndef RAMROD_GL_UNIFORM_RING_H
+#define RAMROD_GL_UNIFORM_RING_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/std140.h"
+#include "ramrod/gl/sync.h"
+#include "ramrod/gl/uniform_buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    /**
+     * @brief Block written in a `uniform_ring`
+     */
+    struct uniform_allocation {
+      // mapped memory to write the block, valid until the next `flush()` or `begin_frame()`
+      void *data{nullptr};
+      // offset in the uniform buffer, a multiple of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+      GLintptr offset{0};
+      GLsizeiptr size{0};
+    };
+
+    struct uniform_ring_statistics {
+      std::size_t frames{0};
+      std::size_t allocations{0};
+      // bytes of the blocks, without the alignment padding
+      std::size_t bytes{0};
+      // allocations refused because the frame's region was full
+      std::size_t overflows{0};
+      // frames which waited for the GPU to release their region
+      std::size_t stalls{0};
+      std::size_t maps{0};
+    };
+
+    /**
+     * @brief Writes the uniform blocks of every draw one after the other in a big buffer
+     *
+     * The `GL_UNIFORM_BUFFER` is split in one region per frame in flight. The blocks of a
+     * frame are written sequentially in its region through an unsynchronized map, each
+     * one aligned to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, and bound with
+     * `uniform_buffer::bind_range()`. A fence is inserted when the frame ends and the
+     * region is written again only once it is signaled, so per draw constants never
+     * wait for the draws using the same memory as `allocate_section()` and `bind_base()`
+     * would.
+     *
+     * The region is mapped by the first allocation and stays mapped while blocks are
+     * written and bound; OpenGL cannot draw from a mapped buffer, so write the blocks of
+     * a batch of draws, call `flush()` once, then bind each block before its draw:
+     *
+     *     ring.begin_frame();
+     *     for(std::size_t i = 0; i < count; ++i)
+     *       blocks[i] = ring.allocate_block(objects[i]);
+     *     ring.flush();
+     *     for(std::size_t i = 0; i < count; ++i){
+     *       ring.bind(0, blocks[i]);
+     *       draw(objects[i]);
+     *     }
+     *
+     * Allocating after `flush()` maps the rest of the region again. Mapping binds the
+     * buffer to `GL_UNIFORM_BUFFER`.
+     */
+    class uniform_ring
+    {
+    public:
+      /**
+       * @brief Creates an empty ring, call `create()` with a current context
+       *
+       * @param frames Specifies the number of frames in flight, each one has its region
+       */
+      uniform_ring(const std::size_t frames = 3);
+      uniform_ring(const uniform_ring &) = delete;
+      uniform_ring &operator=(const uniform_ring &) = delete;
+      ~uniform_ring();
+      /**
+       * @brief Getting the alignment of the blocks
+       *
+       * @return GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, or 0 if the ring was not created
+       */
+      GLint alignment() const;
+      /**
+       * @brief Reserves a block in the region of the current frame
+       *
+       * @param size_in_bytes Specifies the size of the block
+       *
+       * @return The block, its `data` is `nullptr` if the ring was not created, the size
+       *         is 0 or the region is full
+       */
+      uniform_allocation allocate(const std::size_t size_in_bytes);
+      /**
+       * @brief Writes a block described by `std140_layout` in the current frame
+       *
+       * @param block Specifies the value of the uniform block
+       *
+       * @return The block, its `data` is `nullptr` if it could not be allocated
+       */
+      template<typename T>
+      uniform_allocation allocate_block(const T &block){
+        const uniform_allocation allocation{allocate(std140<T>::size)};
+        if(allocation.data != nullptr)
+          std140<T>::pack(block, allocation.data);
+        return allocation;
+      }
+      /**
+       * @brief Ends the current frame and starts writing the next region
+       *
+       * Call it once per frame, before the first allocation. A fence is inserted after
+       * the commands of the ending frame; if the GPU is still using the next region,
+       * it waits for it.
+       *
+       * @return `false` if the ring was not created
+       */
+      bool begin_frame();
+      /**
+       * @brief Binds a block to a uniform buffer binding point
+       *
+       * It does not unmap the region, call `flush()` before drawing.
+       *
+       * @param index      Specifies the binding point
+       * @param allocation Specifies a block of the current frame
+       *
+       * @return `false` if the ring was not created or the block is empty
+       */
+      bool bind(const GLuint index, const uniform_allocation &allocation);
+      /**
+       * @brief Getting the uniform buffer holding every region
+       *
+       * @return The buffer
+       */
+      const uniform_buffer &buffer() const;
+      /**
+       * @brief Getting the size of the region of a frame
+       *
+       * @return Bytes available per frame, alignment padding included
+       */
+      std::size_t capacity() const;
+      /**
+       * @brief Creates the uniform buffer
+       *
+       * @param bytes_per_frame Specifies the bytes of the blocks of one frame, rounded up
+       *                        to the alignment
+       *
+       * @return `false` if the size is 0, the buffer could not be created or the ring
+       *         was previously created
+       */
+      bool create(const std::size_t bytes_per_frame);
+      /**
+       * @brief Deletes the uniform buffer and the fences
+       *
+       * @return `false` if the ring was not created
+       */
+      bool delete_ring();
+      /**
+       * @brief Sends the blocks written so far and unmaps the region
+       *
+       * Call it after writing a batch of blocks and before drawing with them, the `data`
+       * of those blocks cannot be used anymore. `begin_frame()` flushes too.
+       *
+       * @return `false` if the region was not mapped
+       */
+      bool flush();
+      /**
+       * @brief Checking if the ring was created
+       *
+       * @return `true` between `create()` and `delete_ring()`
+       */
+      bool is_created() const;
+      /**
+       * @brief Getting the counters
+       *
+       * @return The counters since the ring was created
+       */
+      const uniform_ring_statistics &statistics() const;
+      /**
+       * @brief Getting the bytes used in the current frame
+       *
+       * @return Bytes of the region used, alignment padding included
+       */
+      std::size_t used() const;
+
+    private:
+      bool map();
+
+      uniform_buffer buffer_;
+      // fence of the last frame written in every region
+      std::vector<sync> fences_;
+      std::size_t frames_, region_bytes_, frame_, cursor_, mapped_from_;
+      GLint alignment_;
+      std::uint8_t *mapped_;
+      uniform_ring_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_UNIFORM_RING_H
@@ -0,0 +1,263 @@
+#ifndef RAMROD_GL_UPLOAD_SCHEDULER_H
+#define RAMROD_GL_UPLOAD_SCHEDULER_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    class buffer;
+    class texture;
+    class uniform_buffer;
+
+    struct upload_statistics {
+      static constexpr std::size_t buckets{16};
+
+      std::size_t completed{0};
+      // uploads finished after their deadline
+      std::size_t missed_deadlines{0};
+      std::size_t total_bytes{0};
+      std::size_t last_frame_bytes{0};
+      std::size_t last_frame_microseconds{0};
+      // frame_bytes[i] counts the frames with queued uploads that sent less than
+      // 1 KiB << i bytes, the last bucket also counts the bigger ones
+      std::array<std::size_t, buckets> frame_bytes{};
+      // latency[i] counts the uploads that were completed less than 128 << i
+      // microseconds after being queued, the last bucket also counts the slower ones
+      std::array<std::size_t, buckets> latency{};
+    };
+
+    /**
+     * @brief Spreads texture and buffer uploads over several frames
+     *
+     * Uploads are queued and `execute()`, called once per frame, sends them to OpenGL
+     * until the frame's byte or time budget is spent. Textures are sent in bands of rows
+     * and buffers in chunks, so a big asset does not stall a single frame. The data
+     * given to the queue functions is not copied, it must stay valid until the upload
+     * completes; the completion callback is the place to free it.
+     */
+    class upload_scheduler
+    {
+    public:
+      typedef std::chrono::steady_clock clock;
+      typedef std::function<void()> completion_callback;
+
+      /**
+       * @brief Creates an upload scheduler
+       *
+       * @param bytes_per_frame Specifies the maximum bytes sent by `execute()`
+       * @param time_per_frame  Specifies the maximum time spent in `execute()`
+       * @param chunk_bytes     Specifies the size of a buffer chunk and the approximate
+       *                        size of a texture band
+       */
+      upload_scheduler(const std::size_t bytes_per_frame = 4 << 20,
+                       const std::chrono::microseconds time_per_frame =
+                         std::chrono::microseconds(2000),
+                       const std::size_t chunk_bytes = 256 << 10);
+      ~upload_scheduler();
+      /**
+       * @brief Getting the byte budget of a frame
+       *
+       * @return Maximum bytes sent by `execute()`
+       */
+      std::size_t bytes_per_frame() const;
+      /**
+       * @brief Setting the byte budget of a frame
+       *
+       * @param new_bytes_per_frame Specifies the maximum bytes sent by `execute()`
+       */
+      void bytes_per_frame(const std::size_t new_bytes_per_frame);
+      /**
+       * @brief Removes an upload from the queue
+       *
+       * The part already sent stays in the texture or buffer and the completion callback
+       * is not called.
+       *
+       * @param ticket Specifies the value returned when queueing the upload
+       *
+       * @return `false` if the upload was already completed or does not exist
+       */
+      bool cancel(const std::uint64_t ticket);
+      /**
+       * @brief Getting the size of buffer chunks and texture bands
+       *
+       * @return Chunk size in bytes
+       */
+      std::size_t chunk_bytes() const;
+      /**
+       * @brief Setting the size of buffer chunks and texture bands
+       *
+       * @param new_chunk_bytes Specifies the chunk size in bytes
+       */
+      void chunk_bytes(const std::size_t new_chunk_bytes);
+      /**
+       * @brief Sends queued uploads to OpenGL within the frame budget
+       *
+       * Uploads whose deadline has passed go first and ignore the budget, then higher
+       * priorities, earlier deadlines and older uploads. At least one band or chunk is
+       * sent per call so every upload eventually completes. Pixel unpack, array, uniform
+       * and vertex array bindings, and the unpack alignment, row length and skips are
+       * restored afterwards.
+       *
+       * @return Number of bytes sent
+       */
+      std::size_t execute();
+      /**
+       * @brief Checking if an upload is still in the queue
+       *
+       * @param ticket Specifies the value returned when queueing the upload
+       *
+       * @return `true` if the upload has not completed yet
+       */
+      bool is_pending(const std::uint64_t ticket) const;
+      /**
+       * @brief Getting the number of queued uploads
+       *
+       * @return Uploads not completed yet
+       */
+      std::size_t pending() const;
+      /**
+       * @brief Getting the bytes left to send
+       *
+       * @return Bytes of every queued upload not sent yet
+       */
+      std::size_t pending_bytes() const;
+      /**
+       * @brief Resets every counter and histogram
+       */
+      void reset_statistics();
+      /**
+       * @brief Getting the upload counters and histograms
+       *
+       * @return Statistics since the creation or the last `reset_statistics()`
+       */
+      const upload_statistics &statistics() const;
+      /**
+       * @brief Getting the time budget of a frame
+       *
+       * @return Maximum time spent in `execute()`
+       */
+      std::chrono::microseconds time_per_frame() const;
+      /**
+       * @brief Setting the time budget of a frame
+       *
+       * @param new_time_per_frame Specifies the maximum time spent in `execute()`
+       */
+      void time_per_frame(const std::chrono::microseconds new_time_per_frame);
+      /**
+       * @brief Queues the data of a `GL_ARRAY_BUFFER`
+       *
+       * The first step calls `buffer::allocate_array()` without data, the following
+       * ones send chunks with `buffer::allocate_section_array()`.
+       *
+       * @param target        Specifies the buffer, its array buffer must be generated
+       * @param data          Specifies the data, it must stay valid until completion
+       * @param size_in_bytes Specifies the size of the data
+       * @param usage         Specifies the expected usage pattern of the data store
+       * @param priority      Specifies the priority, bigger values go first
+       * @param deadline      Specifies when the upload must be completed
+       * @param completed     Specifies a function called once the upload is completed
+       *
+       * @return Ticket of the upload or 0 if the parameters are invalid
+       */
+      std::uint64_t upload_array(buffer &target, const void *data,
+                                 const GLsizei size_in_bytes,
+                                 const GLenum usage = GL_STATIC_DRAW, const int priority = 0,
+                                 const clock::time_point deadline = clock::time_point::max(),
+                                 const completion_callback &completed = nullptr);
+      /**
+       * @brief Queues the data of a `GL_ELEMENT_ARRAY_BUFFER`
+       *
+       * The buffer's vertex array object is bound while sending, see `upload_array()`
+       * for the parameters.
+       *
+       * @return Ticket of the upload or 0 if the parameters are invalid
+       */
+      std::uint64_t upload_element(buffer &target, const void *data,
+                                   const GLsizei size_in_bytes,
+                                   const GLenum usage = GL_STATIC_DRAW, const int priority = 0,
+                                   const clock::time_point deadline = clock::time_point::max(),
+                                   const completion_callback &completed = nullptr);
+      /**
+       * @brief Queues a texture image
+       *
+       * The first step allocates the level without data, the following ones send bands
+       * of rows with `texture::allocate_sub_2d()`.
+       *
+       * @param target          Specifies the texture, it must be generated
+       * @param width           Specifies the width of the image
+       * @param height          Specifies the height of the image
+       * @param data            Specifies tightly packed rows, valid until completion
+       * @param format          Specifies the format of the pixel data
+       * @param type            Specifies the data type of the pixel data
+       * @param internal_format Specifies the internal format of the texture
+       * @param level           Specifies the level-of-detail number
+       * @param priority        Specifies the priority, bigger values go first
+       * @param deadline        Specifies when the upload must be completed
+       * @param completed       Specifies a function called once the upload is completed
+       *
+       * @return Ticket of the upload or 0 if the parameters are invalid
+       */
+      std::uint64_t upload_texture(texture &target, const GLsizei width, const GLsizei height,
+                                   const void *data, const GLenum format = GL_RGBA,
+                                   const GLenum type = GL_UNSIGNED_BYTE,
+                                   const GLint internal_format = GL_RGBA8, const GLint level = 0,
+                                   const int priority = 0,
+                                   const clock::time_point deadline = clock::time_point::max(),
+                                   const completion_callback &completed = nullptr);
+      /**
+       * @brief Queues the data of a `GL_UNIFORM_BUFFER`, see `upload_array()`
+       *
+       * @return Ticket of the upload or 0 if the parameters are invalid
+       */
+      std::uint64_t upload_uniform(uniform_buffer &target, const void *data,
+                                   const GLsizei size_in_bytes,
+                                   const GLenum usage = GL_STATIC_DRAW, const int priority = 0,
+                                   const clock::time_point deadline = clock::time_point::max(),
+                                   const completion_callback &completed = nullptr);
+
+    private:
+      enum class kind : unsigned int {
+        array,
+        element,
+        image,
+        uniform
+      };
+
+      struct job {
+        std::uint64_t ticket;
+        kind type;
+        void *target;
+        const std::uint8_t *data;
+        // bytes for buffers, rows for textures
+        std::size_t size, done;
+        std::size_t row_bytes;
+        GLsizei width;
+        GLenum format, pixel_type, usage;
+        GLint internal_format, level;
+        bool allocated;
+        int priority;
+        clock::time_point queued, deadline;
+        completion_callback completed;
+      };
+
+      std::uint64_t enqueue(job &&item);
+      std::size_t step(job &item, const std::size_t max_bytes);
+
+      std::vector<job> jobs_;
+      std::uint64_t next_ticket_;
+      std::size_t bytes_per_frame_, chunk_bytes_;
+      std::chrono::microseconds time_per_frame_;
+      upload_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_UPLOAD_SCHEDULER_H
@@ -0,0 +1,172 @@
+#ifndef RAMROD_GL_VIDEO_SINK_H
+#define RAMROD_GL_VIDEO_SINK_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/enumerators.h"
+#include "ramrod/gl/readback_queue.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    class frame_buffer;
+
+    struct video_statistics {
+      std::size_t captured{0};
+      std::size_t written{0};
+      // captures which waited because every frame was still read, converted or written
+      std::size_t stalls{0};
+      std::size_t total_bytes{0};
+      // time spent converting the last frame
+      double convert_milliseconds{0.0};
+    };
+
+    /**
+     * @brief Records the rendered frames as YUV 4:2:0 video into a file or a pipe
+     *
+     * `capture()` only queues an asynchronous read of the frame in a `readback_queue`.
+     * Once the GPU finished, the pixels are mapped and converted from BGRA to I420 or
+     * NV12 by a background thread and its helpers, straight from the pixel buffer and
+     * flipping the rows, then written as Y4M or raw planes. Memory is bounded by the
+     * number of frames in flight: every frame owns a pixel buffer and a YUV buffer, and
+     * `capture()` waits when all of them are busy.
+     *
+     * The OpenGL context must be current in the thread calling `capture()` and `close()`.
+     */
+    class video_sink
+    {
+    public:
+      /**
+       * @brief Creates a sink, the threads start when it is opened
+       *
+       * @param frames  Specifies the number of frames in flight
+       * @param threads Specifies the number of converting threads, 0 uses one per
+       *                processor core up to 4
+       */
+      video_sink(const std::size_t frames = 3, const std::size_t threads = 0);
+      ~video_sink();
+      /**
+       * @brief Queues the read of the current read frame buffer
+       *
+       * Reads the `width` x `height` pixels of the bottom left corner.
+       *
+       * @return `false` if the sink is not open or writing failed
+       */
+      bool capture();
+      /**
+       * @brief Queues the read of a frame buffer attachment
+       *
+       * @param source     Specifies the frame buffer
+       * @param attachment Specifies the color attachment
+       *
+       * @return `false` if the sink is not open, writing failed or the frame buffer
+       *         was not created
+       */
+      bool capture(frame_buffer &source, const GLenum attachment = GL_COLOR_ATTACHMENT0);
+      /**
+       * @brief Writes the frames in flight and stops the threads
+       *
+       * The file is closed if it was opened by path.
+       *
+       * @return `false` if it was not open or writing failed
+       */
+      bool close();
+      /**
+       * @brief Checking if frames can be captured
+       *
+       * @return `true` between `open()` and `close()`
+       */
+      bool is_open() const;
+      /**
+       * @brief Creates a file and starts the threads
+       *
+       * @param path        Specifies the file path
+       * @param width       Specifies the width of the frames
+       * @param height      Specifies the height of the frames
+       * @param numerator   Specifies the frame rate numerator
+       * @param denominator Specifies the frame rate denominator
+       * @param container   Specifies the stream format
+       * @param layout      Specifies the plane layout, Y4M only supports I420
+       *
+       * @return `false` if it is already open, the file cannot be created or the
+       *         parameters are not valid
+       */
+      bool open(const std::string &path, const GLsizei width, const GLsizei height,
+                const unsigned int numerator, const unsigned int denominator = 1,
+                const video::container container = video::container::y4m,
+                const video::layout layout = video::layout::i420);
+      /**
+       * @brief Writes into an open stream, such as the input of an encoder from `popen()`
+       *
+       * The stream is not closed by `close()`.
+       *
+       * @param stream Specifies the stream
+       *
+       * @return `false` if it is already open or the parameters are not valid
+       */
+      bool open(std::FILE *stream, const GLsizei width, const GLsizei height,
+                const unsigned int numerator, const unsigned int denominator = 1,
+                const video::container container = video::container::y4m,
+                const video::layout layout = video::layout::i420);
+      /**
+       * @brief Getting the counters, safe while the threads run
+       *
+       * @return A copy of the counters
+       */
+      video_statistics statistics() const;
+
+    private:
+      struct frame {
+        std::vector<std::uint8_t> planes;
+        // mapped pixel pack buffer, `nullptr` while the GPU is reading
+        const std::uint8_t *pixels;
+        std::size_t row_bytes;
+        std::uint64_t ticket;
+        bool busy, converted, written;
+      };
+
+      // the members shared with the threads need `mutex_` locked
+      frame *acquire(std::unique_lock<std::mutex> &lock);
+      void convert_band(frame &item, const std::size_t band);
+      void helper(const std::size_t band, std::uint64_t generation);
+      void map(frame &item, const bool wait);
+      bool submit(frame &item, const std::uint64_t ticket);
+      void update();
+      void worker();
+      bool write(const frame &item);
+
+      readback_queue readbacks_;
+      std::vector<frame> frames_;
+      // frames in capture order, and the ones mapped for the worker
+      std::deque<std::size_t> order_, jobs_;
+
+      std::size_t thread_count_;
+      std::thread worker_;
+      std::vector<std::thread> helpers_;
+
+      mutable std::mutex mutex_;
+      std::condition_variable work_, progress_, bands_, bands_done_;
+      frame *band_frame_;
+      std::uint64_t band_generation_;
+      std::size_t bands_left_;
+
+      std::FILE *stream_;
+      bool owns_stream_, failed_, stopping_;
+      video::container container_;
+      video::layout layout_;
+      GLsizei width_, height_;
+      video_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_VIDEO_SINK_H
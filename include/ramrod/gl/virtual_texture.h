@@ -0,0 +1,229 @@
+#ifndef RAMROD_GL_VIRTUAL_TEXTURE_H
+#define RAMROD_GL_VIRTUAL_TEXTURE_H
+
+// OpenGL loader and core library
+#include "glad/glad.h"
+#include "ramrod/gl/frame_buffer.h"
+#include "ramrod/gl/pixel_buffer.h"
+#include "ramrod/gl/sync.h"
+#include "ramrod/gl/texture.h"
+#include "ramrod/gl/tile_pyramid.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ramrod {
+  namespace gl {
+    struct virtual_texture_statistics {
+      // unique pages found in the last feedback read back
+      std::size_t requested{0};
+      // pages waiting to be uploaded
+      std::size_t pending{0};
+      std::size_t uploads{0};
+      std::size_t evictions{0};
+      // feedback passes skipped because every read back buffer was still in use
+      std::size_t dropped_feedback{0};
+      std::size_t resident_pages{0};
+    };
+
+    /**
+     * @brief Streams a tile pyramid bigger than the video memory through a page cache
+     *
+     * Two textures are used while drawing:
+     *
+     * - The physical texture is a grid of `pages_per_side` x `pages_per_side` pages of
+     *   `page_size()` pixels, each one a tile of the pyramid including its border.
+     * - The indirection texture is an RGBA8 texture with one texel per tile and one
+     *   mipmap level per pyramid level. Every texel points to the finest resident page
+     *   covering it: red and green are the page's column and row inside the physical
+     *   texture, blue is the pyramid level of that page and alpha is 255.
+     *
+     * A shader computes the wanted level and tile exactly like `tile_pyramid::tiles_x()`
+     * does, fetches the indirection texel with `texelFetch()`, recomputes the tile
+     * coordinates at the level stored in blue and samples the physical texture inside
+     * that page, skipping its border.
+     *
+     * The feedback pass draws the same geometry into a small frame buffer between
+     * `begin_feedback()` and `end_feedback()` with a shader that writes the wanted tile
+     * as: red = `x & 255`, green = `y & 255`, blue = `(x >> 8) | ((y >> 8) << 4)` and
+     * alpha = level, all divided by 255. Untouched pixels keep an alpha of 1.0. The
+     * result is read back asynchronously and consumed by a later `update()`.
+     */
+    class virtual_texture
+    {
+    public:
+      /**
+       * @brief Creates an empty virtual texture, see `open()`
+       *
+       * @param pages_per_side  Specifies the physical texture size in pages
+       * @param feedback_width  Specifies the feedback frame buffer's width
+       * @param feedback_height Specifies the feedback frame buffer's height
+       */
+      virtual_texture(const GLsizei pages_per_side = 32, const GLsizei feedback_width = 160,
+                      const GLsizei feedback_height = 90);
+      ~virtual_texture();
+      /**
+       * @brief Binds the feedback frame buffer, sets its viewport and clears it
+       *
+       * @return `false` if no pyramid is open
+       */
+      bool begin_feedback();
+      /**
+       * @brief Binds the physical and the indirection textures
+       *
+       * The same two units are used every frame no matter how many pages are visible.
+       *
+       * @param physical_unit    Specifies the texture unit for the physical texture
+       * @param indirection_unit Specifies the texture unit for the indirection texture
+       *
+       * @return `false` if no pyramid is open
+       */
+      bool bind(const GLuint physical_unit, const GLuint indirection_unit);
+      /**
+       * @brief Deletes the textures, the feedback buffers and unmaps the pyramid
+       *
+       * @return `false` if no pyramid was open
+       */
+      bool close();
+      /**
+       * @brief Starts reading the feedback back and restores the previous frame buffer
+       *        and viewport
+       *
+       * @return `false` if `begin_feedback()` was not called
+       */
+      bool end_feedback();
+      /**
+       * @brief Getting the indirection texture
+       *
+       * @return Reference to the indirection texture
+       */
+      texture &indirection();
+      /**
+       * @brief Checking if a tile has its own page in the physical texture
+       *
+       * @param level Specifies the pyramid level
+       * @param x     Specifies the tile column
+       * @param y     Specifies the tile row
+       *
+       * @return `true` if the tile is resident
+       */
+      bool is_resident(const std::uint32_t level, const std::uint32_t x,
+                       const std::uint32_t y) const;
+      /**
+       * @brief Opens a tile pyramid and creates the textures and feedback buffers
+       *
+       * The coarsest level is uploaded right away and never evicted so every texel of
+       * the indirection texture points to a page.
+       *
+       * @param path Specifies the pyramid file's path
+       *
+       * @return `false` if the file is not a valid pyramid, its pixels are compressed,
+       *         or the physical texture cannot hold the coarsest level
+       */
+      bool open(const std::string &path);
+      /**
+       * @brief Getting the size of a page in pixels, borders included
+       *
+       * @return Page width and height or 0 if no pyramid is open
+       */
+      GLsizei page_size() const;
+      /**
+       * @brief Getting the physical texture
+       *
+       * @return Reference to the physical texture
+       */
+      texture &physical();
+      /**
+       * @brief Getting the open tile pyramid
+       *
+       * @return Reference to the tile pyramid
+       */
+      const tile_pyramid &pyramid() const;
+      /**
+       * @brief Asks for a tile without waiting for the feedback, e.g. to preload the
+       *        area around the camera
+       *
+       * @param level Specifies the pyramid level
+       * @param x     Specifies the tile column
+       * @param y     Specifies the tile row
+       *
+       * @return `false` if the tile does not exist in the pyramid, its coarser parents
+       *         are requested anyway
+       */
+      bool request(const std::uint32_t level, const std::uint32_t x, const std::uint32_t y);
+      /**
+       * @brief Getting the streaming counters
+       *
+       * @return Counters since `open()`
+       */
+      const virtual_texture_statistics &statistics() const;
+      /**
+       * @brief Consumes finished feedback read backs and uploads the pending pages
+       *
+       * Coarser pages are uploaded first so the indirection texture improves evenly.
+       * Call it once per frame, outside of the feedback pass.
+       *
+       * @param max_uploads Specifies the maximum number of pages uploaded by this call
+       *
+       * @return Number of uploaded pages
+       */
+      std::size_t update(const std::size_t max_uploads = 16);
+
+    private:
+      // pages of the coarsest level are pinned and never enter the recently used list
+      struct page {
+        std::uint64_t key;
+        std::uint64_t frame;
+        std::list<std::size_t>::iterator position;
+      };
+
+      struct readback {
+        pixel_buffer buffer;
+        sync fence;
+      };
+
+      static constexpr std::size_t readback_count_{3};
+
+      bool collect_feedback();
+      void map_page(const std::uint32_t level, const std::uint32_t x, const std::uint32_t y,
+                    const std::uint32_t value);
+      void mark_dirty(const std::uint32_t level, const GLint x_0, const GLint y_0,
+                      const GLint x_1, const GLint y_1);
+      void parse_feedback(const std::uint32_t *pixels, const std::size_t count);
+      void unmap_page(const std::uint32_t level, const std::uint32_t x, const std::uint32_t y);
+      bool upload(const std::uint64_t key);
+      void upload_indirection();
+      bool want(const std::uint32_t level, const std::uint32_t x, const std::uint32_t y);
+
+      tile_pyramid pyramid_;
+      texture physical_, indirection_, feedback_color_;
+      frame_buffer feedback_;
+      readback readbacks_[readback_count_];
+      std::size_t write_index_, read_index_;
+
+      std::vector<page> pages_;
+      std::list<std::size_t> recent_;
+      std::vector<std::size_t> free_;
+      std::unordered_map<std::uint64_t, std::size_t> resident_;
+      std::vector<std::uint64_t> pending_;
+
+      // CPU copy of every indirection level and its modified rectangle as
+      // minimum x, minimum y, maximum x and maximum y
+      std::vector<std::vector<std::uint32_t>> entries_;
+      std::vector<GLsizei> entry_width_, entry_height_;
+      std::vector<GLint> dirty_;
+
+      std::uint64_t frame_;
+      GLsizei pages_per_side_, feedback_width_, feedback_height_;
+      GLint previous_frame_buffer_, previous_viewport_[4];
+      bool in_feedback_;
+      virtual_texture_statistics statistics_;
+    };
+  } // namespace: gl
+} // namespace: ramrod
+
+#endif // RAMROD_GL_VIRTUAL_TEXTURE_H
@@ -8,6 +8,7 @@
     Profile: core
     Extensions:
         GL_ARB_enhanced_layouts,
+        GL_ARB_invalidate_subdata,
         GL_EXT_texture_filter_anisotropic
     Loader: True
     Local files: False
@@ -15,9 +16,9 @@
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=4.2" --generator="c" --spec="gl" --extensions="GL_ARB_enhanced_layouts,GL_EXT_texture_filter_anisotropic"
+        --profile="core" --api="gl=4.2" --generator="c" --spec="gl" --extensions="GL_ARB_enhanced_layouts,GL_ARB_invalidate_subdata,GL_EXT_texture_filter_anisotropic"
     Online:
-        http://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.2&extensions=GL_ARB_enhanced_layouts&extensions=GL_EXT_texture_filter_anisotropic
+        http://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.2&extensions=GL_ARB_enhanced_layouts&extensions=GL_ARB_invalidate_subdata&extensions=GL_EXT_texture_filter_anisotropic
 */
 
 #include <stdio.h>
@@ -29,10 +30,10 @@ static void* get_proc(const char *namez);
 
 #if defined(_WIN32) || defined(__CYGWIN__)
 #include <windows.h>
-static HMODULE libGL;
+static GLAD_TLS HMODULE libGL;
 
 typedef void* (APIENTRYP PFNWGLGETPROCADDRESSPROC_PRIVATE)(const char*);
-static PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+static GLAD_TLS PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
 
 #ifdef _MSC_VER
 #ifdef __has_include
@@ -75,11 +76,11 @@ void close_gl(void) {
 }
 #else
 #include <dlfcn.h>
-static void* libGL;
+static GLAD_TLS void* libGL;
 
 #if !defined(__APPLE__) && !defined(__HAIKU__)
 typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
-static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+static GLAD_TLS PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
 #endif
 
 static
@@ -154,18 +155,18 @@ int gladLoadGL(void) {
     return status;
 }
 
-struct gladGLversionStruct GLVersion = { 0, 0 };
+GLAD_TLS struct gladGLversionStruct GLVersion = { 0, 0 };
 
 #if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
 #define _GLAD_IS_SOME_NEW_VERSION 1
 #endif
 
-static int max_loaded_major;
-static int max_loaded_minor;
+static GLAD_TLS int max_loaded_major;
+static GLAD_TLS int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+static GLAD_TLS const char *exts = NULL;
+static GLAD_TLS int num_exts_i = 0;
+static GLAD_TLS char **exts_i = NULL;
 
 static int get_exts(void) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
@@ -253,543 +254,550 @@ static int has_ext(const char *ext) {
 
     return 0;
 }
-int GLAD_GL_VERSION_1_0 = 0;
-int GLAD_GL_VERSION_1_1 = 0;
-int GLAD_GL_VERSION_1_2 = 0;
-int GLAD_GL_VERSION_1_3 = 0;
-int GLAD_GL_VERSION_1_4 = 0;
-int GLAD_GL_VERSION_1_5 = 0;
-int GLAD_GL_VERSION_2_0 = 0;
-int GLAD_GL_VERSION_2_1 = 0;
-int GLAD_GL_VERSION_3_0 = 0;
-int GLAD_GL_VERSION_3_1 = 0;
-int GLAD_GL_VERSION_3_2 = 0;
-int GLAD_GL_VERSION_3_3 = 0;
-int GLAD_GL_VERSION_4_0 = 0;
-int GLAD_GL_VERSION_4_1 = 0;
-int GLAD_GL_VERSION_4_2 = 0;
-PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = NULL;
-PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
-PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
-PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
-PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
-PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = NULL;
-PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
-PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
-PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
-PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
-PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
-PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
-PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
-PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
-PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = NULL;
-PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = NULL;
-PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
-PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
-PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
-PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = NULL;
-PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
-PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
-PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
-PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
-PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = NULL;
-PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = NULL;
-PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
-PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
-PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = NULL;
-PFNGLBLENDFUNCIPROC glad_glBlendFunci = NULL;
-PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
-PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
-PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
-PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
-PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
-PFNGLCLEARPROC glad_glClear = NULL;
-PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
-PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
-PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
-PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
-PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
-PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
-PFNGLCLEARDEPTHFPROC glad_glClearDepthf = NULL;
-PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
-PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
-PFNGLCOLORMASKPROC glad_glColorMask = NULL;
-PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
-PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
-PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
-PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
-PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
-PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
-PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
-PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
-PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
-PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
-PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
-PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
-PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
-PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = NULL;
-PFNGLCULLFACEPROC glad_glCullFace = NULL;
-PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
-PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
-PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
-PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = NULL;
-PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
-PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
-PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
-PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
-PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
-PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
-PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = NULL;
-PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
-PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
-PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
-PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
-PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = NULL;
-PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = NULL;
-PFNGLDEPTHRANGEFPROC glad_glDepthRangef = NULL;
-PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
-PFNGLDISABLEPROC glad_glDisable = NULL;
-PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
-PFNGLDISABLEIPROC glad_glDisablei = NULL;
-PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
-PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
-PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
-PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
-PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
-PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
-PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
-PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
-PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
-PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
-PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
-PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = NULL;
-PFNGLENABLEPROC glad_glEnable = NULL;
-PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
-PFNGLENABLEIPROC glad_glEnablei = NULL;
-PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
-PFNGLENDQUERYPROC glad_glEndQuery = NULL;
-PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = NULL;
-PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
-PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
-PFNGLFINISHPROC glad_glFinish = NULL;
-PFNGLFLUSHPROC glad_glFlush = NULL;
-PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
-PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
-PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
-PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
-PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
-PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
-PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
-PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
-PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
-PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
-PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = NULL;
-PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
-PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
-PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
-PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
-PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = NULL;
-PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
-PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
-PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = NULL;
-PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
-PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = NULL;
-PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = NULL;
-PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = NULL;
-PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
-PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
-PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
-PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
-PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
-PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
-PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
-PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
-PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
-PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
-PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
-PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
-PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = NULL;
-PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
-PFNGLGETERRORPROC glad_glGetError = NULL;
-PFNGLGETFLOATI_VPROC glad_glGetFloati_v = NULL;
-PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
-PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
-PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
-PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
-PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
-PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
-PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
-PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
-PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = NULL;
-PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
-PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
-PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
-PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = NULL;
-PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = NULL;
-PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = NULL;
-PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
-PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = NULL;
-PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
-PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
-PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
-PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
-PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
-PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
-PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
-PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
-PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
-PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
-PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
-PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = NULL;
-PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
-PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
-PFNGLGETSTRINGPROC glad_glGetString = NULL;
-PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
-PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = NULL;
-PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = NULL;
-PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
-PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
-PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
-PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
-PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
-PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
-PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
-PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
-PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
-PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
-PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
-PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
-PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = NULL;
-PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = NULL;
-PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
-PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
-PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
-PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
-PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
-PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = NULL;
-PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
-PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
-PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
-PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
-PFNGLHINTPROC glad_glHint = NULL;
-PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
-PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
-PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
-PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
-PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
-PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = NULL;
-PFNGLISQUERYPROC glad_glIsQuery = NULL;
-PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
-PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
-PFNGLISSHADERPROC glad_glIsShader = NULL;
-PFNGLISSYNCPROC glad_glIsSync = NULL;
-PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
-PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = NULL;
-PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
-PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
-PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
-PFNGLLOGICOPPROC glad_glLogicOp = NULL;
-PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
-PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
-PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
-PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = NULL;
-PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
-PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
-PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
-PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
-PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
-PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
-PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
-PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
-PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
-PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
-PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
-PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
-PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
-PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = NULL;
-PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = NULL;
-PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = NULL;
-PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
-PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
-PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
-PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
-PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
-PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
-PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
-PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
-PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
-PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
-PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
-PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
-PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = NULL;
-PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = NULL;
-PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = NULL;
-PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = NULL;
-PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = NULL;
-PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = NULL;
-PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = NULL;
-PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = NULL;
-PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = NULL;
-PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = NULL;
-PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = NULL;
-PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = NULL;
-PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = NULL;
-PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = NULL;
-PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = NULL;
-PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = NULL;
-PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = NULL;
-PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = NULL;
-PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = NULL;
-PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = NULL;
-PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = NULL;
-PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = NULL;
-PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = NULL;
-PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = NULL;
-PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = NULL;
-PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = NULL;
-PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = NULL;
-PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = NULL;
-PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = NULL;
-PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = NULL;
-PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = NULL;
-PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = NULL;
-PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
-PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
-PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
-PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
-PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = NULL;
-PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
-PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
-PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = NULL;
-PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
-PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
-PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
-PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
-PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
-PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
-PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
-PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
-PFNGLSCISSORPROC glad_glScissor = NULL;
-PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = NULL;
-PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = NULL;
-PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = NULL;
-PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
-PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
-PFNGLSHADERBINARYPROC glad_glShaderBinary = NULL;
-PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
-PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
-PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
-PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
-PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
-PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
-PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
-PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
-PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
-PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
-PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
-PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
-PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
-PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
-PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
-PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
-PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
-PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
-PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
-PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
-PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
-PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
-PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
-PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
-PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
-PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
-PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
-PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
-PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
-PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
-PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
-PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
-PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
-PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
-PFNGLUNIFORM1DPROC glad_glUniform1d = NULL;
-PFNGLUNIFORM1DVPROC glad_glUniform1dv = NULL;
-PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
-PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
-PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
-PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
-PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
-PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
-PFNGLUNIFORM2DPROC glad_glUniform2d = NULL;
-PFNGLUNIFORM2DVPROC glad_glUniform2dv = NULL;
-PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
-PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
-PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
-PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
-PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
-PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
-PFNGLUNIFORM3DPROC glad_glUniform3d = NULL;
-PFNGLUNIFORM3DVPROC glad_glUniform3dv = NULL;
-PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
-PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
-PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
-PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
-PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
-PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
-PFNGLUNIFORM4DPROC glad_glUniform4d = NULL;
-PFNGLUNIFORM4DVPROC glad_glUniform4dv = NULL;
-PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
-PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
-PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
-PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
-PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
-PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
-PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
-PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = NULL;
-PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
-PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = NULL;
-PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
-PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = NULL;
-PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
-PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = NULL;
-PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
-PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = NULL;
-PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
-PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = NULL;
-PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
-PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = NULL;
-PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
-PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = NULL;
-PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
-PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = NULL;
-PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
-PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = NULL;
-PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
-PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
-PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = NULL;
-PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
-PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = NULL;
-PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
-PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
-PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
-PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
-PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
-PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
-PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
-PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
-PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
-PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
-PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
-PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
-PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
-PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
-PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
-PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
-PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
-PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
-PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
-PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
-PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
-PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
-PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
-PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
-PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
-PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
-PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
-PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
-PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
-PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
-PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
-PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
-PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
-PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
-PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
-PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
-PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
-PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
-PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
-PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
-PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
-PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
-PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
-PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
-PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
-PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
-PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
-PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
-PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
-PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
-PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
-PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
-PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
-PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
-PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
-PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
-PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
-PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
-PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = NULL;
-PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = NULL;
-PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = NULL;
-PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = NULL;
-PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = NULL;
-PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = NULL;
-PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = NULL;
-PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = NULL;
-PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = NULL;
-PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
-PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
-PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
-PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
-PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
-PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
-PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
-PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
-PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
-PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
-PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
-PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
-PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
-PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
-PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
-PFNGLVIEWPORTPROC glad_glViewport = NULL;
-PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
-PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
-PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
-PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
-int GLAD_GL_ARB_enhanced_layouts = 0;
-int GLAD_GL_EXT_texture_filter_anisotropic = 0;
+GLAD_TLS int GLAD_GL_VERSION_1_0 = 0;
+GLAD_TLS int GLAD_GL_VERSION_1_1 = 0;
+GLAD_TLS int GLAD_GL_VERSION_1_2 = 0;
+GLAD_TLS int GLAD_GL_VERSION_1_3 = 0;
+GLAD_TLS int GLAD_GL_VERSION_1_4 = 0;
+GLAD_TLS int GLAD_GL_VERSION_1_5 = 0;
+GLAD_TLS int GLAD_GL_VERSION_2_0 = 0;
+GLAD_TLS int GLAD_GL_VERSION_2_1 = 0;
+GLAD_TLS int GLAD_GL_VERSION_3_0 = 0;
+GLAD_TLS int GLAD_GL_VERSION_3_1 = 0;
+GLAD_TLS int GLAD_GL_VERSION_3_2 = 0;
+GLAD_TLS int GLAD_GL_VERSION_3_3 = 0;
+GLAD_TLS int GLAD_GL_VERSION_4_0 = 0;
+GLAD_TLS int GLAD_GL_VERSION_4_1 = 0;
+GLAD_TLS int GLAD_GL_VERSION_4_2 = 0;
+GLAD_TLS PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = NULL;
+GLAD_TLS PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
+GLAD_TLS PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
+GLAD_TLS PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
+GLAD_TLS PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
+GLAD_TLS PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = NULL;
+GLAD_TLS PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
+GLAD_TLS PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
+GLAD_TLS PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
+GLAD_TLS PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
+GLAD_TLS PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
+GLAD_TLS PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
+GLAD_TLS PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
+GLAD_TLS PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
+GLAD_TLS PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = NULL;
+GLAD_TLS PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = NULL;
+GLAD_TLS PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
+GLAD_TLS PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
+GLAD_TLS PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
+GLAD_TLS PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = NULL;
+GLAD_TLS PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
+GLAD_TLS PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
+GLAD_TLS PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
+GLAD_TLS PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
+GLAD_TLS PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = NULL;
+GLAD_TLS PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = NULL;
+GLAD_TLS PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
+GLAD_TLS PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
+GLAD_TLS PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = NULL;
+GLAD_TLS PFNGLBLENDFUNCIPROC glad_glBlendFunci = NULL;
+GLAD_TLS PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
+GLAD_TLS PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
+GLAD_TLS PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
+GLAD_TLS PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
+GLAD_TLS PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
+GLAD_TLS PFNGLCLEARPROC glad_glClear = NULL;
+GLAD_TLS PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
+GLAD_TLS PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
+GLAD_TLS PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
+GLAD_TLS PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
+GLAD_TLS PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
+GLAD_TLS PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
+GLAD_TLS PFNGLCLEARDEPTHFPROC glad_glClearDepthf = NULL;
+GLAD_TLS PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
+GLAD_TLS PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
+GLAD_TLS PFNGLCOLORMASKPROC glad_glColorMask = NULL;
+GLAD_TLS PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
+GLAD_TLS PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
+GLAD_TLS PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
+GLAD_TLS PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
+GLAD_TLS PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
+GLAD_TLS PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
+GLAD_TLS PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
+GLAD_TLS PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
+GLAD_TLS PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
+GLAD_TLS PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
+GLAD_TLS PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
+GLAD_TLS PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
+GLAD_TLS PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
+GLAD_TLS PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
+GLAD_TLS PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
+GLAD_TLS PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
+GLAD_TLS PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
+GLAD_TLS PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
+GLAD_TLS PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
+GLAD_TLS PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
+GLAD_TLS PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = NULL;
+GLAD_TLS PFNGLCULLFACEPROC glad_glCullFace = NULL;
+GLAD_TLS PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
+GLAD_TLS PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
+GLAD_TLS PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
+GLAD_TLS PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = NULL;
+GLAD_TLS PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
+GLAD_TLS PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
+GLAD_TLS PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
+GLAD_TLS PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
+GLAD_TLS PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
+GLAD_TLS PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
+GLAD_TLS PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = NULL;
+GLAD_TLS PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
+GLAD_TLS PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
+GLAD_TLS PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
+GLAD_TLS PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
+GLAD_TLS PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = NULL;
+GLAD_TLS PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = NULL;
+GLAD_TLS PFNGLDEPTHRANGEFPROC glad_glDepthRangef = NULL;
+GLAD_TLS PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
+GLAD_TLS PFNGLDISABLEPROC glad_glDisable = NULL;
+GLAD_TLS PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
+GLAD_TLS PFNGLDISABLEIPROC glad_glDisablei = NULL;
+GLAD_TLS PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
+GLAD_TLS PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
+GLAD_TLS PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
+GLAD_TLS PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
+GLAD_TLS PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
+GLAD_TLS PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
+GLAD_TLS PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
+GLAD_TLS PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
+GLAD_TLS PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
+GLAD_TLS PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
+GLAD_TLS PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
+GLAD_TLS PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
+GLAD_TLS PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
+GLAD_TLS PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
+GLAD_TLS PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
+GLAD_TLS PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = NULL;
+GLAD_TLS PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = NULL;
+GLAD_TLS PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = NULL;
+GLAD_TLS PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = NULL;
+GLAD_TLS PFNGLENABLEPROC glad_glEnable = NULL;
+GLAD_TLS PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
+GLAD_TLS PFNGLENABLEIPROC glad_glEnablei = NULL;
+GLAD_TLS PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
+GLAD_TLS PFNGLENDQUERYPROC glad_glEndQuery = NULL;
+GLAD_TLS PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = NULL;
+GLAD_TLS PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
+GLAD_TLS PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
+GLAD_TLS PFNGLFINISHPROC glad_glFinish = NULL;
+GLAD_TLS PFNGLFLUSHPROC glad_glFlush = NULL;
+GLAD_TLS PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
+GLAD_TLS PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
+GLAD_TLS PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
+GLAD_TLS PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
+GLAD_TLS PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
+GLAD_TLS PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
+GLAD_TLS PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
+GLAD_TLS PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
+GLAD_TLS PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
+GLAD_TLS PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
+GLAD_TLS PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = NULL;
+GLAD_TLS PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
+GLAD_TLS PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
+GLAD_TLS PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
+GLAD_TLS PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
+GLAD_TLS PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = NULL;
+GLAD_TLS PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
+GLAD_TLS PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
+GLAD_TLS PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = NULL;
+GLAD_TLS PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
+GLAD_TLS PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = NULL;
+GLAD_TLS PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = NULL;
+GLAD_TLS PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = NULL;
+GLAD_TLS PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
+GLAD_TLS PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
+GLAD_TLS PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
+GLAD_TLS PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
+GLAD_TLS PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
+GLAD_TLS PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
+GLAD_TLS PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
+GLAD_TLS PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
+GLAD_TLS PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
+GLAD_TLS PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
+GLAD_TLS PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
+GLAD_TLS PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
+GLAD_TLS PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
+GLAD_TLS PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
+GLAD_TLS PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = NULL;
+GLAD_TLS PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
+GLAD_TLS PFNGLGETERRORPROC glad_glGetError = NULL;
+GLAD_TLS PFNGLGETFLOATI_VPROC glad_glGetFloati_v = NULL;
+GLAD_TLS PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
+GLAD_TLS PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
+GLAD_TLS PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
+GLAD_TLS PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
+GLAD_TLS PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
+GLAD_TLS PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
+GLAD_TLS PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
+GLAD_TLS PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
+GLAD_TLS PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = NULL;
+GLAD_TLS PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
+GLAD_TLS PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+GLAD_TLS PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
+GLAD_TLS PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = NULL;
+GLAD_TLS PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = NULL;
+GLAD_TLS PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = NULL;
+GLAD_TLS PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
+GLAD_TLS PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = NULL;
+GLAD_TLS PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
+GLAD_TLS PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
+GLAD_TLS PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
+GLAD_TLS PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
+GLAD_TLS PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
+GLAD_TLS PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
+GLAD_TLS PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
+GLAD_TLS PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
+GLAD_TLS PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
+GLAD_TLS PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
+GLAD_TLS PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
+GLAD_TLS PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = NULL;
+GLAD_TLS PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
+GLAD_TLS PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
+GLAD_TLS PFNGLGETSTRINGPROC glad_glGetString = NULL;
+GLAD_TLS PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
+GLAD_TLS PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = NULL;
+GLAD_TLS PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = NULL;
+GLAD_TLS PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
+GLAD_TLS PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
+GLAD_TLS PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
+GLAD_TLS PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
+GLAD_TLS PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
+GLAD_TLS PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
+GLAD_TLS PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
+GLAD_TLS PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
+GLAD_TLS PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
+GLAD_TLS PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
+GLAD_TLS PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
+GLAD_TLS PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
+GLAD_TLS PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = NULL;
+GLAD_TLS PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = NULL;
+GLAD_TLS PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
+GLAD_TLS PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
+GLAD_TLS PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
+GLAD_TLS PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
+GLAD_TLS PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
+GLAD_TLS PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = NULL;
+GLAD_TLS PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
+GLAD_TLS PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
+GLAD_TLS PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
+GLAD_TLS PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
+GLAD_TLS PFNGLHINTPROC glad_glHint = NULL;
+GLAD_TLS PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = NULL;
+GLAD_TLS PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = NULL;
+GLAD_TLS PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = NULL;
+GLAD_TLS PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = NULL;
+GLAD_TLS PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = NULL;
+GLAD_TLS PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = NULL;
+GLAD_TLS PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
+GLAD_TLS PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
+GLAD_TLS PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
+GLAD_TLS PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
+GLAD_TLS PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
+GLAD_TLS PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = NULL;
+GLAD_TLS PFNGLISQUERYPROC glad_glIsQuery = NULL;
+GLAD_TLS PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
+GLAD_TLS PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
+GLAD_TLS PFNGLISSHADERPROC glad_glIsShader = NULL;
+GLAD_TLS PFNGLISSYNCPROC glad_glIsSync = NULL;
+GLAD_TLS PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
+GLAD_TLS PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = NULL;
+GLAD_TLS PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
+GLAD_TLS PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
+GLAD_TLS PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
+GLAD_TLS PFNGLLOGICOPPROC glad_glLogicOp = NULL;
+GLAD_TLS PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
+GLAD_TLS PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
+GLAD_TLS PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
+GLAD_TLS PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = NULL;
+GLAD_TLS PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
+GLAD_TLS PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
+GLAD_TLS PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
+GLAD_TLS PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
+GLAD_TLS PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
+GLAD_TLS PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
+GLAD_TLS PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
+GLAD_TLS PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
+GLAD_TLS PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
+GLAD_TLS PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
+GLAD_TLS PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
+GLAD_TLS PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
+GLAD_TLS PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
+GLAD_TLS PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = NULL;
+GLAD_TLS PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = NULL;
+GLAD_TLS PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = NULL;
+GLAD_TLS PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
+GLAD_TLS PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
+GLAD_TLS PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
+GLAD_TLS PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
+GLAD_TLS PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
+GLAD_TLS PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
+GLAD_TLS PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
+GLAD_TLS PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
+GLAD_TLS PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
+GLAD_TLS PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
+GLAD_TLS PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+GLAD_TLS PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = NULL;
+GLAD_TLS PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = NULL;
+GLAD_TLS PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
+GLAD_TLS PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
+GLAD_TLS PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
+GLAD_TLS PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
+GLAD_TLS PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = NULL;
+GLAD_TLS PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
+GLAD_TLS PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
+GLAD_TLS PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = NULL;
+GLAD_TLS PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
+GLAD_TLS PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
+GLAD_TLS PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
+GLAD_TLS PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
+GLAD_TLS PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
+GLAD_TLS PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
+GLAD_TLS PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
+GLAD_TLS PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
+GLAD_TLS PFNGLSCISSORPROC glad_glScissor = NULL;
+GLAD_TLS PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = NULL;
+GLAD_TLS PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = NULL;
+GLAD_TLS PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = NULL;
+GLAD_TLS PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
+GLAD_TLS PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
+GLAD_TLS PFNGLSHADERBINARYPROC glad_glShaderBinary = NULL;
+GLAD_TLS PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
+GLAD_TLS PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
+GLAD_TLS PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
+GLAD_TLS PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
+GLAD_TLS PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
+GLAD_TLS PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
+GLAD_TLS PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
+GLAD_TLS PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
+GLAD_TLS PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
+GLAD_TLS PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
+GLAD_TLS PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
+GLAD_TLS PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
+GLAD_TLS PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
+GLAD_TLS PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
+GLAD_TLS PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
+GLAD_TLS PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
+GLAD_TLS PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
+GLAD_TLS PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
+GLAD_TLS PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
+GLAD_TLS PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
+GLAD_TLS PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
+GLAD_TLS PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
+GLAD_TLS PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
+GLAD_TLS PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
+GLAD_TLS PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
+GLAD_TLS PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
+GLAD_TLS PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
+GLAD_TLS PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
+GLAD_TLS PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
+GLAD_TLS PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
+GLAD_TLS PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
+GLAD_TLS PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
+GLAD_TLS PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
+GLAD_TLS PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
+GLAD_TLS PFNGLUNIFORM1DPROC glad_glUniform1d = NULL;
+GLAD_TLS PFNGLUNIFORM1DVPROC glad_glUniform1dv = NULL;
+GLAD_TLS PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
+GLAD_TLS PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
+GLAD_TLS PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
+GLAD_TLS PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
+GLAD_TLS PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
+GLAD_TLS PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
+GLAD_TLS PFNGLUNIFORM2DPROC glad_glUniform2d = NULL;
+GLAD_TLS PFNGLUNIFORM2DVPROC glad_glUniform2dv = NULL;
+GLAD_TLS PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
+GLAD_TLS PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
+GLAD_TLS PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
+GLAD_TLS PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
+GLAD_TLS PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
+GLAD_TLS PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
+GLAD_TLS PFNGLUNIFORM3DPROC glad_glUniform3d = NULL;
+GLAD_TLS PFNGLUNIFORM3DVPROC glad_glUniform3dv = NULL;
+GLAD_TLS PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
+GLAD_TLS PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
+GLAD_TLS PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
+GLAD_TLS PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
+GLAD_TLS PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
+GLAD_TLS PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
+GLAD_TLS PFNGLUNIFORM4DPROC glad_glUniform4d = NULL;
+GLAD_TLS PFNGLUNIFORM4DVPROC glad_glUniform4dv = NULL;
+GLAD_TLS PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
+GLAD_TLS PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
+GLAD_TLS PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
+GLAD_TLS PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
+GLAD_TLS PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
+GLAD_TLS PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
+GLAD_TLS PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = NULL;
+GLAD_TLS PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
+GLAD_TLS PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = NULL;
+GLAD_TLS PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
+GLAD_TLS PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
+GLAD_TLS PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = NULL;
+GLAD_TLS PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
+GLAD_TLS PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
+GLAD_TLS PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
+GLAD_TLS PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
+GLAD_TLS PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
+GLAD_TLS PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
+GLAD_TLS PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
+GLAD_TLS PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
+GLAD_TLS PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
+GLAD_TLS PFNGLVIEWPORTPROC glad_glViewport = NULL;
+GLAD_TLS PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
+GLAD_TLS PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
+GLAD_TLS PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
+GLAD_TLS PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+GLAD_TLS int GLAD_GL_ARB_enhanced_layouts = 0;
+GLAD_TLS int GLAD_GL_ARB_invalidate_subdata = 0;
+GLAD_TLS int GLAD_GL_EXT_texture_filter_anisotropic = 0;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1359,9 +1367,19 @@ static void load_GL_VERSION_4_2(GLADloadproc load) {
 	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)load("glDrawTransformFeedbackInstanced");
 	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)load("glDrawTransformFeedbackStreamInstanced");
 }
+static void load_GL_ARB_invalidate_subdata(GLADloadproc load) {
+	if(!GLAD_GL_ARB_invalidate_subdata) return;
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
 	GLAD_GL_ARB_enhanced_layouts = has_ext("GL_ARB_enhanced_layouts");
+	GLAD_GL_ARB_invalidate_subdata = has_ext("GL_ARB_invalidate_subdata");
 	GLAD_GL_EXT_texture_filter_anisotropic = has_ext("GL_EXT_texture_filter_anisotropic");
 	free_exts();
 	return 1;
@@ -1447,6 +1465,7 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_4_2(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_invalidate_subdata(load);
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
@@ -0,0 +1,853 @@
+#include "ramrod/gl/block_compressor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RAMROD_GL_BLOCK_COMPRESSOR_SSE2
+#endif
+
+#include "ramrod/gl/texture.h"
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      typedef unsigned char block_pixels[16][4];
+      typedef void (*block_encoder)(const block_pixels, const compression::quality,
+                                    unsigned char *);
+
+      // BC1 weight of the second endpoint for every 2 bits index
+      constexpr float bc1_weights[4]{0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+      // BC7 interpolation weights for 4 bits indices
+      constexpr int bc7_weights[16]{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+      void fetch_block(const unsigned char *pixels, const GLsizei width, const GLsizei height,
+                       const int components, const GLsizei block_x, const GLsizei block_y,
+                       block_pixels block){
+        for(int j = 0; j < 4; ++j){
+          const GLsizei y{std::min(block_y * 4 + j, height - 1)};
+          for(int i = 0; i < 4; ++i){
+            const GLsizei x{std::min(block_x * 4 + i, width - 1)};
+            const unsigned char *pixel{pixels + (static_cast<std::size_t>(y) * width + x)
+                                       * components};
+            unsigned char *out{block[j * 4 + i]};
+            out[0] = pixel[0];
+            out[1] = components > 1 ? pixel[1] : 0;
+            out[2] = components > 2 ? pixel[2] : 0;
+            out[3] = components > 3 ? pixel[3] : 255;
+          }
+        }
+      }
+
+      // ::::::::::::::::::::::::::::::::::: Endpoint search ::::::::::::::::::::::::::::::::::::
+
+      template<int N>
+      void bounding_box(const block_pixels block, float low[4], float high[4]){
+        for(int c = 0; c < N; ++c){
+          low[c] = 255.0f;
+          high[c] = 0.0f;
+        }
+        for(int i = 0; i < 16; ++i)
+          for(int c = 0; c < N; ++c){
+            low[c] = std::min(low[c], static_cast<float>(block[i][c]));
+            high[c] = std::max(high[c], static_cast<float>(block[i][c]));
+          }
+        // insetting by 1/16 of the range reduces the error of the interpolated colors
+        for(int c = 0; c < N; ++c){
+          const float inset{(high[c] - low[c]) / 16.0f};
+          low[c] += inset;
+          high[c] -= inset;
+        }
+      }
+
+      template<int N>
+      void principal_axis(const block_pixels block, float low[4], float high[4]){
+        float mean[4]{0.0f, 0.0f, 0.0f, 0.0f};
+        for(int i = 0; i < 16; ++i)
+          for(int c = 0; c < N; ++c)
+            mean[c] += block[i][c];
+        for(int c = 0; c < N; ++c)
+          mean[c] /= 16.0f;
+
+        float covariance[4][4]{};
+        float axis[4]{0.0f, 0.0f, 0.0f, 0.0f};
+        for(int i = 0; i < 16; ++i){
+          float delta[4];
+          for(int c = 0; c < N; ++c)
+            delta[c] = block[i][c] - mean[c];
+          for(int a = 0; a < N; ++a)
+            for(int b = 0; b < N; ++b)
+              covariance[a][b] += delta[a] * delta[b];
+        }
+
+        // power iteration starting from the bounding box diagonal
+        bounding_box<N>(block, low, high);
+        for(int c = 0; c < N; ++c)
+          axis[c] = high[c] - low[c];
+
+        for(int iteration = 0; iteration < 8; ++iteration){
+          float next[4]{0.0f, 0.0f, 0.0f, 0.0f};
+          float norm{0.0f};
+          for(int a = 0; a < N; ++a){
+            for(int b = 0; b < N; ++b)
+              next[a] += covariance[a][b] * axis[b];
+            norm = std::max(norm, std::abs(next[a]));
+          }
+          if(norm <= std::numeric_limits<float>::epsilon()) break;
+          for(int c = 0; c < N; ++c)
+            axis[c] = next[c] / norm;
+        }
+
+        float length{0.0f};
+        for(int c = 0; c < N; ++c)
+          length += axis[c] * axis[c];
+        length = std::sqrt(length);
+
+        if(length <= std::numeric_limits<float>::epsilon()){
+          for(int c = 0; c < N; ++c)
+            low[c] = high[c] = mean[c];
+          return;
+        }
+
+        float minimum{std::numeric_limits<float>::max()};
+        float maximum{std::numeric_limits<float>::lowest()};
+        for(int i = 0; i < 16; ++i){
+          float projection{0.0f};
+          for(int c = 0; c < N; ++c)
+            projection += (block[i][c] - mean[c]) * axis[c] / length;
+          minimum = std::min(minimum, projection);
+          maximum = std::max(maximum, projection);
+        }
+        for(int c = 0; c < N; ++c){
+          low[c] = std::clamp(mean[c] + axis[c] / length * minimum, 0.0f, 255.0f);
+          high[c] = std::clamp(mean[c] + axis[c] / length * maximum, 0.0f, 255.0f);
+        }
+      }
+
+      // weights[i] is the contribution of `second` to the pixel i
+      template<int N>
+      bool least_squares(const block_pixels block, const float weights[16],
+                         float first[4], float second[4]){
+        float alpha2{0.0f}, beta2{0.0f}, alpha_beta{0.0f};
+        float alpha_x[4]{0.0f, 0.0f, 0.0f, 0.0f}, beta_x[4]{0.0f, 0.0f, 0.0f, 0.0f};
+
+        for(int i = 0; i < 16; ++i){
+          const float beta{weights[i]};
+          const float alpha{1.0f - beta};
+          alpha2 += alpha * alpha;
+          beta2 += beta * beta;
+          alpha_beta += alpha * beta;
+          for(int c = 0; c < N; ++c){
+            alpha_x[c] += alpha * block[i][c];
+            beta_x[c] += beta * block[i][c];
+          }
+        }
+
+        const float determinant{alpha2 * beta2 - alpha_beta * alpha_beta};
+        if(std::abs(determinant) <= std::numeric_limits<float>::epsilon()) return false;
+
+        for(int c = 0; c < N; ++c){
+          first[c] = std::clamp((alpha_x[c] * beta2 - beta_x[c] * alpha_beta) / determinant,
+                                0.0f, 255.0f);
+          second[c] = std::clamp((beta_x[c] * alpha2 - alpha_x[c] * alpha_beta) / determinant,
+                                 0.0f, 255.0f);
+        }
+        return true;
+      }
+
+      // ::::::::::::::::::::::::::::::::::::::::: BC1 ::::::::::::::::::::::::::::::::::::::::::
+
+      std::uint16_t pack_565(const float color[4]){
+        const int red{static_cast<int>(std::clamp(color[0], 0.0f, 255.0f) * 31.0f / 255.0f + 0.5f)};
+        const int green{static_cast<int>(std::clamp(color[1], 0.0f, 255.0f) * 63.0f / 255.0f + 0.5f)};
+        const int blue{static_cast<int>(std::clamp(color[2], 0.0f, 255.0f) * 31.0f / 255.0f + 0.5f)};
+        return static_cast<std::uint16_t>((red << 11) | (green << 5) | blue);
+      }
+
+      void unpack_565(const std::uint16_t value, int color[4]){
+        const int red{(value >> 11) & 31};
+        const int green{(value >> 5) & 63};
+        const int blue{value & 31};
+        color[0] = (red << 3) | (red >> 2);
+        color[1] = (green << 2) | (green >> 4);
+        color[2] = (blue << 3) | (blue >> 2);
+        color[3] = 255;
+      }
+
+      void bc1_palette(const std::uint16_t color_0, const std::uint16_t color_1,
+                       int palette[4][4]){
+        unpack_565(color_0, palette[0]);
+        unpack_565(color_1, palette[1]);
+        if(color_0 > color_1){
+          for(int c = 0; c < 3; ++c){
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+          }
+        }else{
+          for(int c = 0; c < 3; ++c){
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+          }
+        }
+        palette[2][3] = palette[3][3] = 255;
+      }
+
+      int bc1_indices(const block_pixels block, const int palette[4][4],
+                      unsigned char indices[16]){
+#ifdef RAMROD_GL_BLOCK_COMPRESSOR_SSE2
+        // red and green are interleaved as 16 bits pairs so one madd gives r² + g²
+        __m128i palette_rg[4], palette_b[4];
+        for(int k = 0; k < 4; ++k){
+          palette_rg[k] = _mm_set1_epi32((palette[k][1] << 16) | palette[k][0]);
+          palette_b[k] = _mm_set1_epi32(palette[k][2]);
+        }
+
+        alignas(16) std::int32_t best_error[16];
+        alignas(16) std::int32_t best_index[16];
+
+        for(int group = 0; group < 4; ++group){
+          const unsigned char (*pixel)[4]{block + group * 4};
+          const __m128i rg{_mm_setr_epi16(pixel[0][0], pixel[0][1], pixel[1][0], pixel[1][1],
+                                          pixel[2][0], pixel[2][1], pixel[3][0], pixel[3][1])};
+          const __m128i b{_mm_setr_epi32(pixel[0][2], pixel[1][2], pixel[2][2], pixel[3][2])};
+
+          __m128i best{_mm_set1_epi32(std::numeric_limits<std::int32_t>::max())};
+          __m128i index{_mm_setzero_si128()};
+
+          for(int k = 0; k < 4; ++k){
+            const __m128i delta_rg{_mm_sub_epi16(rg, palette_rg[k])};
+            const __m128i delta_b{_mm_sub_epi16(b, palette_b[k])};
+            const __m128i distance{_mm_add_epi32(_mm_madd_epi16(delta_rg, delta_rg),
+                                                 _mm_madd_epi16(delta_b, delta_b))};
+            const __m128i closer{_mm_cmplt_epi32(distance, best)};
+            best = _mm_or_si128(_mm_and_si128(closer, distance), _mm_andnot_si128(closer, best));
+            index = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(k)),
+                                 _mm_andnot_si128(closer, index));
+          }
+          _mm_store_si128(reinterpret_cast<__m128i*>(best_error + group * 4), best);
+          _mm_store_si128(reinterpret_cast<__m128i*>(best_index + group * 4), index);
+        }
+
+        int error{0};
+        for(int i = 0; i < 16; ++i){
+          indices[i] = static_cast<unsigned char>(best_index[i]);
+          error += best_error[i];
+        }
+        return error;
+#else
+        int error{0};
+        for(int i = 0; i < 16; ++i){
+          int best{std::numeric_limits<int>::max()};
+          for(int k = 0; k < 4; ++k){
+            int distance{0};
+            for(int c = 0; c < 3; ++c){
+              const int delta{block[i][c] - palette[k][c]};
+              distance += delta * delta;
+            }
+            if(distance < best){
+              best = distance;
+              indices[i] = static_cast<unsigned char>(k);
+            }
+          }
+          error += best;
+        }
+        return error;
+#endif
+      }
+
+      void encode_bc1(const block_pixels block, const compression::quality quality,
+                      unsigned char *out){
+        float low[4], high[4];
+        if(quality == compression::quality::fast)
+          bounding_box<3>(block, low, high);
+        else
+          principal_axis<3>(block, low, high);
+
+        std::uint16_t color_0{pack_565(high)}, color_1{pack_565(low)};
+        if(color_0 < color_1) std::swap(color_0, color_1);
+
+        int palette[4][4];
+        unsigned char indices[16];
+        bc1_palette(color_0, color_1, palette);
+        int error{bc1_indices(block, palette, indices)};
+
+        if(quality == compression::quality::high){
+          for(int iteration = 0; iteration < 2 && color_0 != color_1; ++iteration){
+            float weights[16];
+            for(int i = 0; i < 16; ++i)
+              weights[i] = bc1_weights[indices[i]];
+            if(!least_squares<3>(block, weights, high, low)) break;
+
+            std::uint16_t refined_0{pack_565(high)}, refined_1{pack_565(low)};
+            if(refined_0 < refined_1) std::swap(refined_0, refined_1);
+            if(refined_0 == refined_1) break;
+
+            int refined_palette[4][4];
+            unsigned char refined_indices[16];
+            bc1_palette(refined_0, refined_1, refined_palette);
+            const int refined_error{bc1_indices(block, refined_palette, refined_indices)};
+            if(refined_error >= error) break;
+
+            error = refined_error;
+            color_0 = refined_0;
+            color_1 = refined_1;
+            std::memcpy(indices, refined_indices, 16);
+          }
+        }
+
+        std::uint32_t bits{0};
+        for(int i = 0; i < 16; ++i)
+          bits |= static_cast<std::uint32_t>(indices[i]) << (2 * i);
+
+        out[0] = static_cast<unsigned char>(color_0);
+        out[1] = static_cast<unsigned char>(color_0 >> 8);
+        out[2] = static_cast<unsigned char>(color_1);
+        out[3] = static_cast<unsigned char>(color_1 >> 8);
+        for(int i = 0; i < 4; ++i)
+          out[4 + i] = static_cast<unsigned char>(bits >> (8 * i));
+      }
+
+      void decode_bc1(const unsigned char *in, block_pixels block){
+        const std::uint16_t color_0{static_cast<std::uint16_t>(in[0] | (in[1] << 8))};
+        const std::uint16_t color_1{static_cast<std::uint16_t>(in[2] | (in[3] << 8))};
+        int palette[4][4];
+        bc1_palette(color_0, color_1, palette);
+
+        for(int i = 0; i < 16; ++i){
+          const int index{(in[4 + i / 4] >> (2 * (i % 4))) & 3};
+          for(int c = 0; c < 4; ++c)
+            block[i][c] = static_cast<unsigned char>(palette[index][c]);
+        }
+      }
+
+      // :::::::::::::::::::::::::::::::::::::: BC4 and BC5 :::::::::::::::::::::::::::::::::::::
+
+      void bc4_palette(const int red_0, const int red_1, int palette[8]){
+        palette[0] = red_0;
+        palette[1] = red_1;
+        if(red_0 > red_1){
+          for(int i = 2; i < 8; ++i)
+            palette[i] = ((8 - i) * red_0 + (i - 1) * red_1 + 3) / 7;
+        }else{
+          for(int i = 2; i < 6; ++i)
+            palette[i] = ((6 - i) * red_0 + (i - 1) * red_1 + 2) / 5;
+          palette[6] = 0;
+          palette[7] = 255;
+        }
+      }
+
+      int bc4_indices(const unsigned char values[16], const int palette[8],
+                      unsigned char indices[16]){
+#ifdef RAMROD_GL_BLOCK_COMPRESSOR_SSE2
+        // all 16 values fit in a single register, distances are computed as saturated
+        // absolute differences
+        const __m128i pixels{_mm_loadu_si128(reinterpret_cast<const __m128i*>(values))};
+        __m128i best{_mm_set1_epi8(static_cast<char>(0xFF))};
+        __m128i index{_mm_setzero_si128()};
+
+        for(int k = 0; k < 8; ++k){
+          const __m128i entry{_mm_set1_epi8(static_cast<char>(palette[k]))};
+          const __m128i distance{_mm_or_si128(_mm_subs_epu8(pixels, entry),
+                                              _mm_subs_epu8(entry, pixels))};
+          const __m128i minimum{_mm_min_epu8(distance, best)};
+          const __m128i unchanged{_mm_cmpeq_epi8(minimum, best)};
+          index = _mm_or_si128(_mm_andnot_si128(unchanged, _mm_set1_epi8(static_cast<char>(k))),
+                               _mm_and_si128(unchanged, index));
+          best = minimum;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(indices), index);
+
+        const __m128i zero{_mm_setzero_si128()};
+        const __m128i low{_mm_unpacklo_epi8(best, zero)};
+        const __m128i high{_mm_unpackhi_epi8(best, zero)};
+        const __m128i squares{_mm_add_epi32(_mm_madd_epi16(low, low), _mm_madd_epi16(high, high))};
+        alignas(16) std::int32_t sums[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(sums), squares);
+        return sums[0] + sums[1] + sums[2] + sums[3];
+#else
+        int error{0};
+        for(int i = 0; i < 16; ++i){
+          int best{std::numeric_limits<int>::max()};
+          for(int k = 0; k < 8; ++k){
+            const int distance{std::abs(values[i] - palette[k])};
+            if(distance < best){
+              best = distance;
+              indices[i] = static_cast<unsigned char>(k);
+            }
+          }
+          error += best * best;
+        }
+        return error;
+#endif
+      }
+
+      void encode_bc4_channel(const unsigned char values[16],
+                              const compression::quality quality, unsigned char *out){
+        int low{255}, high{0};
+        int inner_low{255}, inner_high{0};
+        for(int i = 0; i < 16; ++i){
+          low = std::min(low, static_cast<int>(values[i]));
+          high = std::max(high, static_cast<int>(values[i]));
+          if(values[i] != 0 && values[i] != 255){
+            inner_low = std::min(inner_low, static_cast<int>(values[i]));
+            inner_high = std::max(inner_high, static_cast<int>(values[i]));
+          }
+        }
+
+        int red_0{high}, red_1{low};
+        int palette[8];
+        unsigned char indices[16];
+        bc4_palette(red_0, red_1, palette);
+        int error{bc4_indices(values, palette, indices)};
+
+        const auto evaluate = [&](const int candidate_0, const int candidate_1){
+          int candidate_palette[8];
+          unsigned char candidate_indices[16];
+          bc4_palette(candidate_0, candidate_1, candidate_palette);
+          const int candidate_error{bc4_indices(values, candidate_palette, candidate_indices)};
+          if(candidate_error < error){
+            error = candidate_error;
+            red_0 = candidate_0;
+            red_1 = candidate_1;
+            std::memcpy(indices, candidate_indices, 16);
+          }
+        };
+
+        if(quality != compression::quality::fast && error > 0){
+          // the six values mode keeps exact 0 and 255, which suits occupancy masks
+          if(inner_low > inner_high) inner_low = inner_high = 0;
+          evaluate(inner_low, inner_high);
+        }
+
+        if(quality == compression::quality::high && error > 0 && high > low){
+          const int base_0{red_0 > red_1 ? red_0 : high};
+          const int base_1{red_0 > red_1 ? red_1 : low};
+          for(int delta_0 = -2; delta_0 <= 2; ++delta_0)
+            for(int delta_1 = -2; delta_1 <= 2; ++delta_1){
+              const int candidate_0{base_0 + delta_0}, candidate_1{base_1 + delta_1};
+              if(candidate_0 > 255 || candidate_1 < 0 || candidate_0 <= candidate_1) continue;
+              evaluate(candidate_0, candidate_1);
+            }
+        }
+
+        std::uint64_t bits{0};
+        for(int i = 0; i < 16; ++i)
+          bits |= static_cast<std::uint64_t>(indices[i]) << (3 * i);
+
+        out[0] = static_cast<unsigned char>(red_0);
+        out[1] = static_cast<unsigned char>(red_1);
+        for(int i = 0; i < 6; ++i)
+          out[2 + i] = static_cast<unsigned char>(bits >> (8 * i));
+      }
+
+      void decode_bc4_channel(const unsigned char *in, block_pixels block, const int channel){
+        int palette[8];
+        bc4_palette(in[0], in[1], palette);
+
+        std::uint64_t bits{0};
+        for(int i = 0; i < 6; ++i)
+          bits |= static_cast<std::uint64_t>(in[2 + i]) << (8 * i);
+
+        for(int i = 0; i < 16; ++i)
+          block[i][channel] = static_cast<unsigned char>(palette[(bits >> (3 * i)) & 7]);
+      }
+
+      void encode_bc4(const block_pixels block, const compression::quality quality,
+                      unsigned char *out){
+        unsigned char values[16];
+        for(int i = 0; i < 16; ++i)
+          values[i] = block[i][0];
+        encode_bc4_channel(values, quality, out);
+      }
+
+      void encode_bc5(const block_pixels block, const compression::quality quality,
+                      unsigned char *out){
+        unsigned char red[16], green[16];
+        for(int i = 0; i < 16; ++i){
+          red[i] = block[i][0];
+          green[i] = block[i][1];
+        }
+        encode_bc4_channel(red, quality, out);
+        encode_bc4_channel(green, quality, out + 8);
+      }
+
+      // :::::::::::::::::::::::::::::::::::::: BC7 mode 6 ::::::::::::::::::::::::::::::::::::::
+
+      void bc7_quantize(const float color[4], const int pbit, int quantized[4]){
+        for(int c = 0; c < 4; ++c)
+          quantized[c] = std::clamp(static_cast<int>(std::lround((color[c] - pbit) / 2.0f)),
+                                    0, 127);
+      }
+
+      int bc7_best_pbit(const float color[4]){
+        int best_pbit{0};
+        float best_error{std::numeric_limits<float>::max()};
+        for(int pbit = 0; pbit < 2; ++pbit){
+          int quantized[4];
+          bc7_quantize(color, pbit, quantized);
+          float error{0.0f};
+          for(int c = 0; c < 4; ++c){
+            const float delta{color[c] - ((quantized[c] << 1) | pbit)};
+            error += delta * delta;
+          }
+          if(error < best_error){
+            best_error = error;
+            best_pbit = pbit;
+          }
+        }
+        return best_pbit;
+      }
+
+      void bc7_palette(const int endpoint_0[4], const int pbit_0,
+                       const int endpoint_1[4], const int pbit_1, int palette[16][4]){
+        for(int k = 0; k < 16; ++k)
+          for(int c = 0; c < 4; ++c){
+            const int value_0{(endpoint_0[c] << 1) | pbit_0};
+            const int value_1{(endpoint_1[c] << 1) | pbit_1};
+            palette[k][c] = ((64 - bc7_weights[k]) * value_0 + bc7_weights[k] * value_1 + 32) >> 6;
+          }
+      }
+
+      int bc7_indices(const block_pixels block, const int palette[16][4],
+                      unsigned char indices[16]){
+        int error{0};
+        for(int i = 0; i < 16; ++i){
+          int best{std::numeric_limits<int>::max()};
+          for(int k = 0; k < 16; ++k){
+            int distance{0};
+            for(int c = 0; c < 4; ++c){
+              const int delta{block[i][c] - palette[k][c]};
+              distance += delta * delta;
+            }
+            if(distance < best){
+              best = distance;
+              indices[i] = static_cast<unsigned char>(k);
+            }
+          }
+          error += best;
+        }
+        return error;
+      }
+
+      struct bc7_candidate {
+        int endpoint_0[4], endpoint_1[4];
+        int pbit_0, pbit_1;
+        unsigned char indices[16];
+        int error;
+      };
+
+      void bc7_evaluate(const block_pixels block, const float low[4], const float high[4],
+                        const int pbit_0, const int pbit_1, bc7_candidate &best){
+        bc7_candidate candidate;
+        candidate.pbit_0 = pbit_0;
+        candidate.pbit_1 = pbit_1;
+        bc7_quantize(low, pbit_0, candidate.endpoint_0);
+        bc7_quantize(high, pbit_1, candidate.endpoint_1);
+
+        int palette[16][4];
+        bc7_palette(candidate.endpoint_0, pbit_0, candidate.endpoint_1, pbit_1, palette);
+        candidate.error = bc7_indices(block, palette, candidate.indices);
+        if(candidate.error < best.error)
+          best = candidate;
+      }
+
+      void bc7_write(unsigned char *out, int &position, const unsigned int value, const int bits){
+        for(int b = 0; b < bits; ++b, ++position)
+          if((value >> b) & 1u)
+            out[position >> 3] |= static_cast<unsigned char>(1u << (position & 7));
+      }
+
+      unsigned int bc7_read(const unsigned char *in, int &position, const int bits){
+        unsigned int value{0};
+        for(int b = 0; b < bits; ++b, ++position)
+          value |= ((in[position >> 3] >> (position & 7)) & 1u) << b;
+        return value;
+      }
+
+      void encode_bc7(const block_pixels block, const compression::quality quality,
+                      unsigned char *out){
+        float low[4], high[4];
+        if(quality == compression::quality::fast)
+          bounding_box<4>(block, low, high);
+        else
+          principal_axis<4>(block, low, high);
+
+        bc7_candidate best;
+        best.error = std::numeric_limits<int>::max();
+
+        if(quality == compression::quality::high){
+          for(int pbits = 0; pbits < 4; ++pbits)
+            bc7_evaluate(block, low, high, pbits & 1, pbits >> 1, best);
+
+          for(int iteration = 0; iteration < 2 && best.error > 0; ++iteration){
+            float weights[16];
+            for(int i = 0; i < 16; ++i)
+              weights[i] = bc7_weights[best.indices[i]] / 64.0f;
+            if(!least_squares<4>(block, weights, low, high)) break;
+
+            const int previous_error{best.error};
+            for(int pbits = 0; pbits < 4; ++pbits)
+              bc7_evaluate(block, low, high, pbits & 1, pbits >> 1, best);
+            if(best.error >= previous_error) break;
+          }
+        }else{
+          bc7_evaluate(block, low, high, bc7_best_pbit(low), bc7_best_pbit(high), best);
+        }
+
+        // the anchor index (pixel 0) is stored with its most significant bit implied as 0
+        if(best.indices[0] & 8){
+          for(int c = 0; c < 4; ++c)
+            std::swap(best.endpoint_0[c], best.endpoint_1[c]);
+          std::swap(best.pbit_0, best.pbit_1);
+          for(int i = 0; i < 16; ++i)
+            best.indices[i] = static_cast<unsigned char>(15 - best.indices[i]);
+        }
+
+        std::memset(out, 0, 16);
+        int position{0};
+        bc7_write(out, position, 1u << 6, 7);
+        for(int c = 0; c < 4; ++c){
+          bc7_write(out, position, static_cast<unsigned int>(best.endpoint_0[c]), 7);
+          bc7_write(out, position, static_cast<unsigned int>(best.endpoint_1[c]), 7);
+        }
+        bc7_write(out, position, static_cast<unsigned int>(best.pbit_0), 1);
+        bc7_write(out, position, static_cast<unsigned int>(best.pbit_1), 1);
+        bc7_write(out, position, best.indices[0], 3);
+        for(int i = 1; i < 16; ++i)
+          bc7_write(out, position, best.indices[i], 4);
+      }
+
+      void decode_bc7(const unsigned char *in, block_pixels block){
+        if((in[0] & 0x7F) != 0x40){
+          std::memset(block, 0, sizeof(block_pixels));
+          return;
+        }
+
+        int position{7};
+        int endpoint_0[4], endpoint_1[4];
+        for(int c = 0; c < 4; ++c){
+          endpoint_0[c] = static_cast<int>(bc7_read(in, position, 7));
+          endpoint_1[c] = static_cast<int>(bc7_read(in, position, 7));
+        }
+        const int pbit_0{static_cast<int>(bc7_read(in, position, 1))};
+        const int pbit_1{static_cast<int>(bc7_read(in, position, 1))};
+
+        int palette[16][4];
+        bc7_palette(endpoint_0, pbit_0, endpoint_1, pbit_1, palette);
+
+        for(int i = 0; i < 16; ++i){
+          const unsigned int index{bc7_read(in, position, i == 0 ? 3 : 4)};
+          for(int c = 0; c < 4; ++c)
+            block[i][c] = static_cast<unsigned char>(palette[index][c]);
+        }
+      }
+
+      block_encoder select_encoder(const compression::format format){
+        switch(format){
+          case compression::format::bc4: return encode_bc4;
+          case compression::format::bc5: return encode_bc5;
+          case compression::format::bc7: return encode_bc7;
+          default: return encode_bc1;
+        }
+      }
+
+      int stored_channels(const compression::format format){
+        switch(format){
+          case compression::format::bc4: return 1;
+          case compression::format::bc5: return 2;
+          case compression::format::bc7: return 4;
+          default: return 3;
+        }
+      }
+    } // namespace
+
+    block_compressor::block_compressor(const compression::format format,
+                                       const compression::quality quality,
+                                       const unsigned int threads) :
+      format_(format),
+      quality_(quality),
+      threads_(threads),
+      scratch_()
+    {}
+
+    std::size_t block_compressor::block_size() const {
+      return format_ == compression::format::bc1 || format_ == compression::format::bc4 ? 8 : 16;
+    }
+
+    bool block_compressor::compress(const void *pixels, const GLsizei width, const GLsizei height,
+                                    const int components, void *output) const {
+      if(pixels == nullptr || output == nullptr || width <= 0 || height <= 0
+         || components < 1 || components > 4) return false;
+
+      const unsigned char *source{static_cast<const unsigned char*>(pixels)};
+      unsigned char *destination{static_cast<unsigned char*>(output)};
+      const GLsizei blocks_x{(width + 3) / 4}, blocks_y{(height + 3) / 4};
+      const std::size_t size{block_size()};
+      const block_encoder encoder{select_encoder(format_)};
+      const compression::quality quality{quality_};
+
+      const auto encode_rows = [=](const GLsizei first_row, const GLsizei last_row){
+        block_pixels block;
+        for(GLsizei block_y = first_row; block_y < last_row; ++block_y)
+          for(GLsizei block_x = 0; block_x < blocks_x; ++block_x){
+            fetch_block(source, width, height, components, block_x, block_y, block);
+            encoder(block, quality,
+                    destination + (static_cast<std::size_t>(block_y) * blocks_x + block_x) * size);
+          }
+      };
+
+      GLsizei workers{static_cast<GLsizei>(threads_ > 0 ? threads_
+                                                        : std::thread::hardware_concurrency())};
+      workers = std::clamp(workers, 1, blocks_y);
+
+      if(workers == 1){
+        encode_rows(0, blocks_y);
+        return true;
+      }
+
+      const GLsizei rows_per_worker{(blocks_y + workers - 1) / workers};
+      std::vector<std::thread> pool;
+      pool.reserve(static_cast<std::size_t>(workers - 1));
+
+      for(GLsizei first = rows_per_worker; first < blocks_y; first += rows_per_worker)
+        pool.emplace_back(encode_rows, first, std::min(first + rows_per_worker, blocks_y));
+
+      encode_rows(0, std::min(rows_per_worker, blocks_y));
+
+      for(std::thread &worker : pool)
+        worker.join();
+      return true;
+    }
+
+    std::size_t block_compressor::compressed_size(const GLsizei width,
+                                                  const GLsizei height) const {
+      if(width <= 0 || height <= 0) return 0;
+      return static_cast<std::size_t>((width + 3) / 4) * static_cast<std::size_t>((height + 3) / 4)
+             * block_size();
+    }
+
+    bool block_compressor::decompress(const void *blocks, const GLsizei width,
+                                      const GLsizei height, void *rgba) const {
+      if(blocks == nullptr || rgba == nullptr || width <= 0 || height <= 0) return false;
+
+      const unsigned char *source{static_cast<const unsigned char*>(blocks)};
+      unsigned char *destination{static_cast<unsigned char*>(rgba)};
+      const GLsizei blocks_x{(width + 3) / 4}, blocks_y{(height + 3) / 4};
+      const std::size_t size{block_size()};
+
+      for(GLsizei block_y = 0; block_y < blocks_y; ++block_y)
+        for(GLsizei block_x = 0; block_x < blocks_x; ++block_x){
+          const unsigned char *in{source + (static_cast<std::size_t>(block_y) * blocks_x
+                                            + block_x) * size};
+          block_pixels block;
+
+          switch(format_){
+            case compression::format::bc4:
+              std::memset(block, 0, sizeof(block));
+              decode_bc4_channel(in, block, 0);
+              for(int i = 0; i < 16; ++i) block[i][3] = 255;
+            break;
+            case compression::format::bc5:
+              std::memset(block, 0, sizeof(block));
+              decode_bc4_channel(in, block, 0);
+              decode_bc4_channel(in + 8, block, 1);
+              for(int i = 0; i < 16; ++i) block[i][3] = 255;
+            break;
+            case compression::format::bc7:
+              decode_bc7(in, block);
+            break;
+            default:
+              decode_bc1(in, block);
+            break;
+          }
+
+          for(int j = 0; j < 4; ++j){
+            const GLsizei y{block_y * 4 + j};
+            if(y >= height) break;
+            for(int i = 0; i < 4; ++i){
+              const GLsizei x{block_x * 4 + i};
+              if(x >= width) break;
+              std::memcpy(destination + (static_cast<std::size_t>(y) * width + x) * 4,
+                          block[j * 4 + i], 4);
+            }
+          }
+        }
+      return true;
+    }
+
+    compression::format block_compressor::format() const {
+      return format_;
+    }
+
+    void block_compressor::format(const compression::format new_format){
+      format_ = new_format;
+    }
+
+    GLenum block_compressor::internal_format() const {
+      switch(format_){
+        case compression::format::bc4: return GL_COMPRESSED_RED_RGTC1;
+        case compression::format::bc5: return GL_COMPRESSED_RG_RGTC2;
+        case compression::format::bc7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        default: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+      }
+    }
+
+    double block_compressor::psnr(const void *pixels, const GLsizei width, const GLsizei height,
+                                  const int components, const void *blocks) const {
+      if(pixels == nullptr || blocks == nullptr || width <= 0 || height <= 0
+         || components < 1 || components > 4) return -1.0;
+
+      std::vector<unsigned char> decoded(static_cast<std::size_t>(width) * height * 4);
+      if(!decompress(blocks, width, height, decoded.data())) return -1.0;
+
+      const unsigned char *source{static_cast<const unsigned char*>(pixels)};
+      const int channels{stored_channels(format_)};
+      const std::size_t count{static_cast<std::size_t>(width) * height};
+      double squared_error{0.0};
+
+      for(std::size_t i = 0; i < count; ++i)
+        for(int c = 0; c < channels; ++c){
+          const int original{c < components ? source[i * components + c] : (c == 3 ? 255 : 0)};
+          const double delta{static_cast<double>(original - decoded[i * 4 + c])};
+          squared_error += delta * delta;
+        }
+
+      if(squared_error == 0.0) return std::numeric_limits<double>::infinity();
+      const double mean_squared_error{squared_error / static_cast<double>(count * channels)};
+      return 10.0 * std::log10(255.0 * 255.0 / mean_squared_error);
+    }
+
+    compression::quality block_compressor::quality() const {
+      return quality_;
+    }
+
+    void block_compressor::quality(const compression::quality new_quality){
+      quality_ = new_quality;
+    }
+
+    unsigned int block_compressor::threads() const {
+      return threads_;
+    }
+
+    void block_compressor::threads(const unsigned int new_threads){
+      threads_ = new_threads;
+    }
+
+    bool block_compressor::upload(texture &target, const void *pixels, const GLsizei width,
+                                  const GLsizei height, const int components, const GLint level){
+      if(target.id() == 0) return false;
+
+      scratch_.resize(compressed_size(width, height));
+      if(!compress(pixels, width, height, components, scratch_.data())) return false;
+
+      return target.allocate_compressed(width, height, scratch_.data(),
+                                        static_cast<GLsizei>(scratch_.size()),
+                                        internal_format(), level);
+    }
+  } // namespace: gl
+} // namespace: ramrod
@@ -186,6 +186,17 @@ namespace ramrod {
       return vertex_array_;
     }
 
+    void *buffer::map_array_when_ready(sync &ready, const GLenum access,
+                                       const GLuint64 timeout){
+      if(array_buffer_ == 0 || array_size_ <= 0) return nullptr;
+
+      const fence::status status{ready.wait(timeout)};
+      if(status == fence::status::timeout || status == fence::status::failed) return nullptr;
+
+      glBindBuffer(GL_ARRAY_BUFFER, array_buffer_);
+      return glMapBufferRange(GL_ARRAY_BUFFER, 0, array_size_, access);
+    }
+
     GLint buffer::size_array(){
       GLint size{0};
       if(array_buffer_ > 0){
@@ -204,6 +215,12 @@ namespace ramrod {
       return size;
     }
 
+    bool buffer::unmap_array(){
+      if(array_buffer_ == 0) return false;
+      glBindBuffer(GL_ARRAY_BUFFER, array_buffer_);
+      return glUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE;
+    }
+
     void buffer::vertex_bind(){
       glBindVertexArray(vertex_array_);
     }
@@ -0,0 +1,244 @@
+#include "ramrod/gl/context.h"
+
+#ifndef GLAD_THREAD_LOCAL
+#include <mutex>
+#endif
+
+#ifdef RAMROD_GL_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#ifdef RAMROD_GL_OSMESA
+#include <GL/osmesa.h>
+#endif
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+#ifdef GLAD_THREAD_LOCAL
+      // library whose entry points fill the function pointers of this thread
+      thread_local headless::backend glad_backend{headless::backend::none};
+#else
+      std::mutex glad_mutex;
+      headless::backend glad_backend{headless::backend::none};
+#endif
+
+#ifdef RAMROD_GL_EGL
+      // The display is shared by every context and never terminated, terminating it
+      // would destroy the contexts of the other threads
+      EGLDisplay egl_display(){
+        static const EGLDisplay display{[]{
+          EGLDisplay created{EGL_NO_DISPLAY};
+          const auto get_platform_display{reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"))};
+          if(get_platform_display != nullptr)
+            created = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA,
+                                           EGL_DEFAULT_DISPLAY, nullptr);
+          if(created == EGL_NO_DISPLAY)
+            created = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+          if(created == EGL_NO_DISPLAY) return created;
+
+          EGLint major{0}, minor{0};
+          if(eglInitialize(created, &major, &minor) != EGL_TRUE) return EGL_NO_DISPLAY;
+          return created;
+        }()};
+        return display;
+      }
+
+      void *create_egl(const int major, const int minor, void *shared){
+        const EGLDisplay display{egl_display()};
+        if(display == EGL_NO_DISPLAY || eglBindAPI(EGL_OPENGL_API) != EGL_TRUE) return nullptr;
+
+        const EGLint config_attributes[]{
+          EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+          EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+          EGL_NONE
+        };
+        EGLConfig config{nullptr};
+        EGLint configs{0};
+        if(eglChooseConfig(display, config_attributes, &config, 1, &configs) != EGL_TRUE
+           || configs == 0)
+          config = nullptr;
+
+        const EGLint context_attributes[]{
+          EGL_CONTEXT_MAJOR_VERSION, major,
+          EGL_CONTEXT_MINOR_VERSION, minor,
+          EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+          EGL_NONE
+        };
+        const EGLContext created{eglCreateContext(display, config,
+                                                  shared == nullptr ? EGL_NO_CONTEXT : shared,
+                                                  context_attributes)};
+        return created == EGL_NO_CONTEXT ? nullptr : created;
+      }
+#endif
+
+#ifdef RAMROD_GL_OSMESA
+      void *create_osmesa(const int major, const int minor, void *shared){
+        const int attributes[]{
+          OSMESA_FORMAT, OSMESA_RGBA,
+          OSMESA_DEPTH_BITS, 24,
+          OSMESA_STENCIL_BITS, 8,
+          OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+          OSMESA_CONTEXT_MAJOR_VERSION, major,
+          OSMESA_CONTEXT_MINOR_VERSION, minor,
+          0
+        };
+        return OSMesaCreateContextAttribs(attributes, static_cast<OSMesaContext>(shared));
+      }
+#endif
+
+      GLADloadproc loader(const headless::backend backend){
+#ifdef RAMROD_GL_EGL
+        if(backend == headless::backend::egl)
+          return reinterpret_cast<GLADloadproc>(eglGetProcAddress);
+#endif
+#ifdef RAMROD_GL_OSMESA
+        if(backend == headless::backend::osmesa)
+          return reinterpret_cast<GLADloadproc>(OSMesaGetProcAddress);
+#endif
+        return nullptr;
+      }
+
+      bool load_glad(const headless::backend backend){
+#ifndef GLAD_THREAD_LOCAL
+        // the function pointers are shared by every thread, a context from another
+        // library cannot be used without overwriting the ones of the other threads
+        const std::lock_guard<std::mutex> lock(glad_mutex);
+        if(glad_backend != headless::backend::none) return glad_backend == backend;
+#else
+        if(glad_backend == backend) return true;
+#endif
+        const GLADloadproc load{loader(backend)};
+        if(load == nullptr || gladLoadGLLoader(load) == 0) return false;
+        glad_backend = backend;
+        return true;
+      }
+    }
+
+    context::context() :
+      backend_(headless::backend::none),
+      handle_(nullptr),
+      osmesa_buffer_{0, 0, 0, 0},
+      units_()
+    {}
+
+    context::~context(){
+      destroy();
+    }
+
+    headless::backend context::backend() const{
+      return backend_;
+    }
+
+    bool context::create(const int major, const int minor, headless::backend backend,
+                         context *shared){
+      if(handle_ != nullptr) return false;
+      void *shared_handle{nullptr};
+      if(shared != nullptr){
+        // a context can only share objects with one of the same library
+        if(backend != headless::backend::automatic && backend != shared->backend_) return false;
+        backend = shared->backend_;
+        shared_handle = shared->handle_;
+      }
+      const bool any{backend == headless::backend::automatic};
+
+#ifdef RAMROD_GL_EGL
+      if(handle_ == nullptr && (any || backend == headless::backend::egl)){
+        handle_ = create_egl(major, minor, shared_handle);
+        if(handle_ != nullptr) backend_ = headless::backend::egl;
+      }
+#endif
+#ifdef RAMROD_GL_OSMESA
+      if(handle_ == nullptr && (any || backend == headless::backend::osmesa)){
+        handle_ = create_osmesa(major, minor, shared_handle);
+        if(handle_ != nullptr) backend_ = headless::backend::osmesa;
+      }
+#endif
+#if !defined(RAMROD_GL_EGL) && !defined(RAMROD_GL_OSMESA)
+      static_cast<void>(major);
+      static_cast<void>(minor);
+      static_cast<void>(any);
+      static_cast<void>(shared_handle);
+#endif
+      return handle_ != nullptr;
+    }
+
+    bool context::destroy(){
+      if(handle_ == nullptr) return false;
+      if(current_ == this) release();
+
+#ifdef RAMROD_GL_EGL
+      if(backend_ == headless::backend::egl)
+        eglDestroyContext(egl_display(), static_cast<EGLContext>(handle_));
+#endif
+#ifdef RAMROD_GL_OSMESA
+      if(backend_ == headless::backend::osmesa)
+        OSMesaDestroyContext(static_cast<OSMesaContext>(handle_));
+#endif
+      handle_ = nullptr;
+      backend_ = headless::backend::none;
+      units_.invalidate();
+      return true;
+    }
+
+    bool context::is_created() const{
+      return handle_ != nullptr;
+    }
+
+    bool context::make_current(){
+      if(handle_ == nullptr) return false;
+
+      bool made{false};
+#ifdef RAMROD_GL_EGL
+      if(backend_ == headless::backend::egl && eglBindAPI(EGL_OPENGL_API) == EGL_TRUE)
+        made = eglMakeCurrent(egl_display(), EGL_NO_SURFACE, EGL_NO_SURFACE,
+                              static_cast<EGLContext>(handle_)) == EGL_TRUE;
+#endif
+#ifdef RAMROD_GL_OSMESA
+      if(backend_ == headless::backend::osmesa)
+        made = OSMesaMakeCurrent(static_cast<OSMesaContext>(handle_), osmesa_buffer_,
+                                 GL_UNSIGNED_BYTE, 1, 1) == GL_TRUE;
+#endif
+      if(!made) return false;
+
+      // the entry points of a library do not depend on the context, they are loaded
+      // once per thread (or per process without GLAD_THREAD_LOCAL)
+      if(!load_glad(backend_)) return false;
+
+      current_ = this;
+      texture_units::make_current(&units_);
+      return true;
+    }
+
+    bool context::release(){
+      if(current_ != this) return false;
+
+#ifdef RAMROD_GL_EGL
+      if(backend_ == headless::backend::egl){
+        // releases the context of the API bound to the calling thread
+        eglBindAPI(EGL_OPENGL_API);
+        eglMakeCurrent(egl_display(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+      }
+#endif
+#ifdef RAMROD_GL_OSMESA
+      if(backend_ == headless::backend::osmesa)
+        OSMesaMakeCurrent(nullptr, nullptr, GL_UNSIGNED_BYTE, 0, 0);
+#endif
+      current_ = nullptr;
+      texture_units::make_current(nullptr);
+      return true;
+    }
+
+    texture_units &context::units(){
+      return units_;
+    }
+
+    context *context::current(){
+      return current_;
+    }
+
+    thread_local context *context::current_{nullptr};
+  } // namespace: gl
+} // namespace: ramrod
@@ -0,0 +1,105 @@
+#include "ramrod/gl/damage_tracker.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "ramrod/gl/pixel_conversion.h"
+
+namespace ramrod {
+  namespace gl {
+    damage_tracker::damage_tracker(const GLsizei tile_size) :
+      hashes_(),
+      previous_(),
+      tile_size_(tile_size > 0 ? tile_size : 64),
+      width_(0),
+      height_(0),
+      pixel_bytes_(0),
+      valid_(false),
+      statistics_()
+    {}
+
+    damage_tracker::~damage_tracker(){}
+
+    std::size_t damage_tracker::detect(const void *pixels, const std::size_t row_bytes,
+                                       const GLsizei width, const GLsizei height,
+                                       const std::size_t pixel_bytes,
+                                       std::vector<damage_tile> &dirty){
+      dirty.clear();
+      if(pixels == nullptr || width <= 0 || height <= 0 || pixel_bytes == 0) return 0;
+
+      const std::size_t columns{static_cast<std::size_t>((width + tile_size_ - 1) / tile_size_)};
+      const std::size_t rows{static_cast<std::size_t>((height + tile_size_ - 1) / tile_size_)};
+      if(width != width_ || height != height_ || pixel_bytes != pixel_bytes_){
+        width_ = width;
+        height_ = height;
+        pixel_bytes_ = pixel_bytes;
+        valid_ = false;
+      }
+
+      hashes_.resize(columns * rows);
+      pixel::tile_hashes(static_cast<const std::uint8_t*>(pixels), row_bytes,
+                         static_cast<std::size_t>(width), static_cast<std::size_t>(height),
+                         pixel_bytes, static_cast<std::size_t>(tile_size_), hashes_.data());
+
+      for(std::size_t row = 0; row < rows; ++row){
+        for(std::size_t column = 0; column < columns; ++column){
+          const std::size_t index{row * columns + column};
+          if(valid_ && hashes_[index] == previous_[index]) continue;
+
+          damage_tile tile;
+          tile.column = static_cast<std::uint32_t>(column);
+          tile.row = static_cast<std::uint32_t>(row);
+          tile.x = static_cast<GLint>(column) * tile_size_;
+          tile.y = static_cast<GLint>(row) * tile_size_;
+          tile.width = std::min(tile_size_, width - tile.x);
+          tile.height = std::min(tile_size_, height - tile.y);
+          dirty.push_back(tile);
+          statistics_.dirty_bytes += static_cast<std::size_t>(tile.width) * tile.height
+                                     * pixel_bytes;
+        }
+      }
+
+      hashes_.swap(previous_);
+      valid_ = true;
+      ++statistics_.frames;
+      statistics_.tiles += columns * rows;
+      statistics_.dirty_tiles += dirty.size();
+      return dirty.size();
+    }
+
+    std::size_t damage_tracker::pack(const void *pixels, const std::size_t row_bytes,
+                                     const std::size_t pixel_bytes,
+                                     const std::vector<damage_tile> &tiles,
+                                     std::vector<std::uint8_t> &packed) const{
+      std::size_t size{0};
+      for(const damage_tile &tile : tiles)
+        size += static_cast<std::size_t>(tile.width) * tile.height * pixel_bytes;
+      packed.resize(size);
+      if(pixels == nullptr) return 0;
+
+      const std::uint8_t *source{static_cast<const std::uint8_t*>(pixels)};
+      std::uint8_t *destination{packed.data()};
+      for(const damage_tile &tile : tiles){
+        const std::size_t tile_row{static_cast<std::size_t>(tile.width) * pixel_bytes};
+        for(GLsizei line = 0; line < tile.height; ++line){
+          std::memcpy(destination, source + static_cast<std::size_t>(tile.y + line) * row_bytes
+                                   + static_cast<std::size_t>(tile.x) * pixel_bytes, tile_row);
+          destination += tile_row;
+        }
+      }
+      return size;
+    }
+
+    void damage_tracker::reset(){
+      valid_ = false;
+    }
+
+    const damage_statistics &damage_tracker::statistics() const{
+      return statistics_;
+    }
+
+    GLsizei damage_tracker::tile_size() const{
+      return tile_size_;
+    }
+  } // namespace: gl
+} // namespace: ramrod
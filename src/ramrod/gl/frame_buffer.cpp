@@ -1,6 +1,7 @@
 #include "ramrod/gl/frame_buffer.h"
 
 #include "ramrod/gl/constants.h"
+#include "ramrod/gl/texture.h"
 
 namespace ramrod {
   namespace gl {
@@ -9,7 +10,8 @@ namespace ramrod {
       render_id_(0),
       frame_attachment_(GL_NONE),
       render_attachment_(GL_NONE),
-      render_format_(GL_NONE)
+      render_format_(GL_NONE),
+      discard_()
     {
       if(generate)
         generate_frame(add_render_buffer);
@@ -39,10 +41,20 @@ namespace ramrod {
       return true;
     }
 
+    bool frame_buffer::attach_texture(texture &image, const GLenum attachment,
+                                      const GLint level){
+      if(image.id() == 0) return false;
+      return attach_2D(image.id(), attachment, image.texture_target(), level);
+    }
+
     void frame_buffer::bind(){
       glBindFramebuffer(GL_FRAMEBUFFER, frame_id_);
     }
 
+    bool frame_buffer::can_invalidate(){
+      return GLAD_GL_ARB_invalidate_subdata && glInvalidateFramebuffer != nullptr;
+    }
+
     void frame_buffer::bind_render(){
       glBindRenderbuffer(GL_RENDERBUFFER, render_id_);
     }
@@ -56,6 +68,7 @@ namespace ramrod {
 
       glDeleteFramebuffers(1, &frame_id_);
       frame_id_ = 0;
+      discard_.clear();
 
       delete_render();
       return true;
@@ -69,6 +82,16 @@ namespace ramrod {
       return true;
     }
 
+    bool frame_buffer::discard_on_release(const GLsizei number_of_attachments,
+                                          const GLenum *attachments){
+      if(frame_id_ == 0) return false;
+      if(number_of_attachments > 0)
+        discard_.assign(attachments, attachments + number_of_attachments);
+      else
+        discard_.clear();
+      return true;
+    }
+
     bool frame_buffer::draw_buffer(){
       if(frame_id_ == 0) return false;
       glDrawBuffers(1, &frame_attachment_);
@@ -117,12 +140,19 @@ namespace ramrod {
       return render_id_ > 0;
     }
 
+    bool frame_buffer::invalidate(const GLsizei number_of_attachments, const GLenum *attachments){
+      if(frame_id_ == 0) return false;
+      if(can_invalidate() && number_of_attachments > 0)
+        glInvalidateFramebuffer(GL_FRAMEBUFFER, number_of_attachments, attachments);
+      return true;
+    }
+
     bool frame_buffer::is_created(){
       return frame_id_ > 0;
     }
 
     bool frame_buffer::read_buffer(){
-      if(frame_attachment_ != GL_NONE) return false;
+      if(frame_id_ == 0 || frame_attachment_ == GL_NONE) return false;
       glReadBuffer(frame_attachment_);
       return true;
     }
@@ -136,6 +166,13 @@ namespace ramrod {
     }
 
     void frame_buffer::release(){
+      if(!discard_.empty() && can_invalidate()){
+        GLint bound{0};
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &bound);
+        if(static_cast<GLuint>(bound) == frame_id_)
+          glInvalidateFramebuffer(GL_FRAMEBUFFER, static_cast<GLsizei>(discard_.size()),
+                                  discard_.data());
+      }
       glBindFramebuffer(GL_FRAMEBUFFER, 0);
     }
 
@@ -162,6 +199,33 @@ namespace ramrod {
       return true;
     }
 
+    bool frame_buffer::render_storage_multisample(const GLsizei samples, const GLsizei width,
+                                                  const GLsizei height,
+                                                  const GLenum internal_format){
+      if(render_id_ == 0) return false;
+      glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, render_format_ = internal_format,
+                                       width, height);
+      return true;
+    }
+
+    bool frame_buffer::resolve_to(frame_buffer &destination, const GLsizei width,
+                                  const GLsizei height, const GLbitfield mask,
+                                  const GLenum filter){
+      if(frame_id_ == 0) return false;
+
+      GLint previous_read{0}, previous_draw{0};
+      glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous_read);
+      glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous_draw);
+
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, frame_id_);
+      glBindFramebuffer(GL_DRAW_FRAMEBUFFER, destination.frame_id_);
+      glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, mask, filter);
+
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previous_read));
+      glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(previous_draw));
+      return true;
+    }
+
     GLenum frame_buffer::status(){
       return glCheckFramebufferStatus(GL_FRAMEBUFFER);
     }
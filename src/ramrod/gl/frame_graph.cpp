@@ -0,0 +1,354 @@
+#include "ramrod/gl/frame_graph.h"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_set>
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      bool contains(const std::vector<std::size_t> &list, const std::size_t value){
+        return std::find(list.begin(), list.end(), value) != list.end();
+      }
+
+      bool shares(const std::vector<std::size_t> &first, const std::vector<std::size_t> &second){
+        for(const std::size_t value : first)
+          if(contains(second, value)) return true;
+        return false;
+      }
+    }
+
+    frame_graph::frame_graph(render_target_pool &pool, const bool gpu_timing) :
+      pool_(pool),
+      resources_(),
+      passes_(),
+      order_(),
+      timings_(),
+      statistics_(),
+      frame_(0),
+      compiled_(false),
+      gpu_timing_(gpu_timing)
+    {}
+
+    frame_graph::~frame_graph(){
+      reset();
+    }
+
+    std::size_t frame_graph::add_pass(const render_pass &pass){
+      pass_node node{pass, false, {}, {}};
+      node.queries.fill(0);
+      node.pending.fill(false);
+      if(gpu_timing_)
+        glGenQueries(static_cast<GLsizei>(query_frames), node.queries.data());
+
+      pass_timing timing;
+      timing.name = pass.name;
+      passes_.push_back(std::move(node));
+      timings_.push_back(std::move(timing));
+      compiled_ = false;
+      return passes_.size() - 1;
+    }
+
+    bool frame_graph::compile(){
+      compiled_ = false;
+      order_.clear();
+
+      // validating the declarations
+      for(std::size_t p = 0; p < passes_.size(); ++p){
+        const render_pass &pass{passes_[p].pass};
+        for(const std::size_t read : pass.reads){
+          if(read >= resources_.size()) return false;
+          bool written{false};
+          for(std::size_t q = 0; q < p && !written; ++q)
+            written = contains(passes_[q].pass.writes, read);
+          if(!written) return false;
+        }
+
+        std::size_t depths{0};
+        for(const std::size_t write : pass.writes){
+          if(write >= resources_.size()) return false;
+          const render_target_description &first{resources_[pass.writes.front()].description};
+          const render_target_description &current{resources_[write].description};
+          if(current.width != first.width || current.height != first.height) return false;
+          if(render_target::attachment(current.internal_format) != GL_COLOR_ATTACHMENT0)
+            ++depths;
+        }
+        if(depths > 1) return false;
+      }
+
+      // culling: walking backwards from the outputs through what every kept pass reads
+      std::unordered_set<std::size_t> needed;
+      for(std::size_t r = 0; r < resources_.size(); ++r)
+        if(resources_[r].output) needed.insert(r);
+
+      for(std::size_t p = passes_.size(); p-- > 0;){
+        pass_node &node{passes_[p]};
+        node.kept = node.pass.side_effect || node.pass.writes.empty();
+        for(const std::size_t write : node.pass.writes)
+          node.kept = node.kept || needed.count(write) > 0;
+        if(!node.kept) continue;
+
+        for(const std::size_t write : node.pass.writes)
+          if(!loads(node, write)) needed.erase(write);
+        for(const std::size_t write : node.pass.writes)
+          if(loads(node, write)) needed.insert(write);
+        for(const std::size_t read : node.pass.reads)
+          needed.insert(read);
+      }
+
+      // sorting: submission order, preferring the pass writing the same attachments as
+      // the previous one when its dependencies allow it
+      std::vector<std::size_t> remaining;
+      for(std::size_t p = 0; p < passes_.size(); ++p)
+        if(passes_[p].kept) remaining.push_back(p);
+
+      while(!remaining.empty()){
+        std::size_t chosen{remaining.size()};
+        std::size_t first_ready{remaining.size()};
+        for(std::size_t i = 0; i < remaining.size(); ++i){
+          bool ready{true};
+          for(std::size_t j = 0; j < i && ready; ++j)
+            ready = !depends(remaining[i], remaining[j]);
+          if(!ready) continue;
+          if(first_ready == remaining.size()) first_ready = i;
+          if(!order_.empty() && !passes_[remaining[i]].pass.writes.empty()
+             && passes_[remaining[i]].pass.writes == passes_[order_.back()].pass.writes){
+            chosen = i;
+            break;
+          }
+        }
+        if(chosen == remaining.size()) chosen = first_ready;
+        order_.push_back(remaining[chosen]);
+        remaining.erase(remaining.begin() + static_cast<std::ptrdiff_t>(chosen));
+      }
+
+      // lifetimes
+      for(resource_node &resource : resources_){
+        resource.first = invalid_resource;
+        resource.last = 0;
+      }
+      for(std::size_t step = 0; step < order_.size(); ++step){
+        const render_pass &pass{passes_[order_[step]].pass};
+        for(const std::vector<std::size_t> *list : {&pass.reads, &pass.writes}){
+          for(const std::size_t r : *list){
+            resources_[r].first = std::min(resources_[r].first, step);
+            resources_[r].last = std::max(resources_[r].last, step);
+          }
+        }
+      }
+
+      for(std::size_t p = 0; p < passes_.size(); ++p){
+        timings_[p].culled = !passes_[p].kept;
+        if(!passes_[p].kept){
+          timings_[p].cpu_milliseconds = 0.0;
+          timings_[p].gpu_milliseconds = 0.0;
+        }
+      }
+      compiled_ = true;
+      return true;
+    }
+
+    std::size_t frame_graph::create(const std::string &name,
+                                    const render_target_description &description){
+      resources_.push_back({name, description, false, invalid_resource, 0, nullptr});
+      compiled_ = false;
+      return resources_.size() - 1;
+    }
+
+    bool frame_graph::execute(){
+      if(!compiled_) return false;
+
+      GLint previous_frame{0};
+      GLint previous_viewport[4];
+      glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_frame);
+      glGetIntegerv(GL_VIEWPORT, previous_viewport);
+
+      for(resource_node &resource : resources_)
+        resource.target = nullptr;
+
+      statistics_ = frame_graph_statistics();
+      statistics_.passes = order_.size();
+      statistics_.culled = passes_.size() - order_.size();
+
+      const std::size_t slot{static_cast<std::size_t>(frame_ % query_frames)};
+      const std::vector<std::size_t> *bound_writes{nullptr};
+      frame_buffer *bound_frame{nullptr};
+      bool success{true};
+
+      for(std::size_t step = 0; step < order_.size() && success; ++step){
+        const std::size_t index{order_[step]};
+        pass_node &node{passes_[index]};
+        const render_pass &pass{node.pass};
+        const auto started = std::chrono::steady_clock::now();
+
+        if(gpu_timing_){
+          read_queries(node, timings_[index], slot);
+          glBeginQuery(GL_TIME_ELAPSED, node.queries[slot]);
+        }
+
+        for(resource_node &resource : resources_){
+          if(resource.first != step) continue;
+          resource.target = pool_.acquire(resource.description);
+          if(resource.target == nullptr) success = false;
+        }
+
+        if(success){
+          if(bound_writes != nullptr && *bound_writes == pass.writes){
+            ++statistics_.merged;
+          }else if(pass.writes.empty()){
+            glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_frame));
+            glViewport(previous_viewport[0], previous_viewport[1],
+                       previous_viewport[2], previous_viewport[3]);
+            bound_frame = nullptr;
+            ++statistics_.frame_buffer_binds;
+          }else{
+            std::vector<render_target*> colors;
+            render_target *depth{nullptr};
+            for(const std::size_t write : pass.writes){
+              render_target *written{resources_[write].target};
+              if(written->attachment() == GL_COLOR_ATTACHMENT0)
+                colors.push_back(written);
+              else
+                depth = written;
+            }
+            bound_frame = pool_.acquire_frame_buffer(colors, depth);
+            success = bound_frame != nullptr;
+            const render_target_description &size{resources_[pass.writes.front()].description};
+            glViewport(0, 0, size.width, size.height);
+            ++statistics_.frame_buffer_binds;
+          }
+          bound_writes = &pass.writes;
+        }
+
+        if(success){
+          if(pass.clear != 0){
+            glClearColor(pass.clear_color[0], pass.clear_color[1],
+                         pass.clear_color[2], pass.clear_color[3]);
+            glClearDepth(pass.clear_depth);
+            glClearStencil(pass.clear_stencil);
+            glClear(pass.clear);
+          }
+          if(pass.execute) pass.execute(*this);
+        }
+
+        if(gpu_timing_){
+          glEndQuery(GL_TIME_ELAPSED);
+          node.pending[slot] = true;
+        }
+
+        // attachments no later pass reads do not have to be stored back to memory
+        if(success && bound_frame != nullptr){
+          std::vector<GLenum> discarded;
+          GLenum color{GL_COLOR_ATTACHMENT0};
+          for(const std::size_t write : pass.writes){
+            const resource_node &resource{resources_[write]};
+            const GLenum attachment{resource.target->attachment()};
+            const GLenum point{attachment == GL_COLOR_ATTACHMENT0 ? color++ : attachment};
+            if(resource.last == step && !resource.output) discarded.push_back(point);
+          }
+          if(!discarded.empty()){
+            bound_frame->invalidate(static_cast<GLsizei>(discarded.size()), discarded.data());
+            statistics_.invalidated += discarded.size();
+          }
+        }
+
+        for(resource_node &resource : resources_){
+          if(resource.target == nullptr || resource.output) continue;
+          if(resource.last == step || !success){
+            pool_.release(resource.target);
+            resource.target = nullptr;
+          }
+        }
+
+        timings_[index].cpu_milliseconds =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()
+                                                      - started).count();
+      }
+
+      glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_frame));
+      glViewport(previous_viewport[0], previous_viewport[1],
+                 previous_viewport[2], previous_viewport[3]);
+      ++frame_;
+      return success;
+    }
+
+    texture *frame_graph::image(const std::size_t resource){
+      render_target *acquired{target(resource)};
+      return acquired == nullptr ? nullptr : acquired->image();
+    }
+
+    const std::vector<std::size_t> &frame_graph::order() const{
+      return order_;
+    }
+
+    bool frame_graph::output(const std::size_t resource){
+      if(resource >= resources_.size()) return false;
+      resources_[resource].output = true;
+      compiled_ = false;
+      return true;
+    }
+
+    void frame_graph::reset(){
+      if(gpu_timing_)
+        for(pass_node &node : passes_)
+          glDeleteQueries(static_cast<GLsizei>(query_frames), node.queries.data());
+
+      passes_.clear();
+      resources_.clear();
+      order_.clear();
+      timings_.clear();
+      statistics_ = frame_graph_statistics();
+      compiled_ = false;
+    }
+
+    const frame_graph_statistics &frame_graph::statistics() const{
+      return statistics_;
+    }
+
+    render_target *frame_graph::target(const std::size_t resource){
+      if(resource >= resources_.size()) return nullptr;
+      return resources_[resource].target;
+    }
+
+    const std::vector<pass_timing> &frame_graph::timings() const{
+      return timings_;
+    }
+
+    bool frame_graph::depends(const std::size_t later, const std::size_t earlier) const{
+      const render_pass &first{passes_[earlier].pass};
+      const render_pass &second{passes_[later].pass};
+      // the default frame buffer is shared by every pass without writes
+      if(first.writes.empty() && second.writes.empty()) return true;
+      return shares(second.reads, first.writes) || shares(second.writes, first.writes)
+          || shares(second.writes, first.reads);
+    }
+
+    bool frame_graph::loads(const pass_node &node, const std::size_t resource) const{
+      switch(render_target::attachment(resources_[resource].description.internal_format)){
+        case GL_COLOR_ATTACHMENT0:
+        return (node.pass.clear & GL_COLOR_BUFFER_BIT) == 0;
+        case GL_DEPTH_ATTACHMENT:
+        return (node.pass.clear & GL_DEPTH_BUFFER_BIT) == 0;
+        case GL_STENCIL_ATTACHMENT:
+        return (node.pass.clear & GL_STENCIL_BUFFER_BIT) == 0;
+        default:
+        return (node.pass.clear & (GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT))
+            != (GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+      }
+    }
+
+    void frame_graph::read_queries(pass_node &node, pass_timing &timing, const std::size_t slot){
+      if(!node.pending[slot]) return;
+
+      GLint available{GL_FALSE};
+      glGetQueryObjectiv(node.queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+      if(available == GL_TRUE){
+        GLuint64 nanoseconds{0};
+        glGetQueryObjectui64v(node.queries[slot], GL_QUERY_RESULT, &nanoseconds);
+        timing.gpu_milliseconds = static_cast<double>(nanoseconds) / 1.0e6;
+      }
+      // a result still not available is dropped rather than waited for
+      node.pending[slot] = false;
+    }
+  } // namespace: gl
+} // namespace: ramrod
@@ -0,0 +1,506 @@
+#include "ramrod/gl/image_encoder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <utility>
+
+#ifdef RAMROD_GL_ZLIB
+#include <zlib.h>
+#endif
+
+#include "ramrod/gl/pixel_conversion.h"
+#include "ramrod/gl/readback_pool.h"
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      // PNG bands are not smaller than this, the zlib window restarts at every band
+      constexpr std::size_t minimum_band_rows{64};
+
+      // Copies a row in RGB(A) order
+      void load_row(const std::uint8_t *source, std::uint8_t *destination,
+                    const std::size_t width, const std::size_t channels, const bool swap){
+        if(!swap){
+          std::memcpy(destination, source, width * channels);
+        }else if(channels == 4){
+          pixel::swap_red_blue(source, destination, width);
+        }else{
+          for(std::size_t i = 0; i < width * 3; i += 3){
+            destination[i] = source[i + 2];
+            destination[i + 1] = source[i + 1];
+            destination[i + 2] = source[i];
+          }
+        }
+      }
+
+      void put_big_endian(std::uint8_t *destination, const std::uint32_t value){
+        destination[0] = static_cast<std::uint8_t>(value >> 24);
+        destination[1] = static_cast<std::uint8_t>(value >> 16);
+        destination[2] = static_cast<std::uint8_t>(value >> 8);
+        destination[3] = static_cast<std::uint8_t>(value);
+      }
+
+#ifdef RAMROD_GL_ZLIB
+      std::uint8_t paeth(const int a, const int b, const int c){
+        const int p{a + b - c};
+        const int pa{std::abs(p - a)}, pb{std::abs(p - b)}, pc{std::abs(p - c)};
+        if(pa <= pb && pa <= pc) return static_cast<std::uint8_t>(a);
+        return static_cast<std::uint8_t>(pb <= pc ? b : c);
+      }
+
+      // Filters a row with the type whose output has the smallest sum of absolute
+      // values, the heuristic of libpng; `previous` is `nullptr` for the first row
+      void filter_row(const std::uint8_t *row, const std::uint8_t *previous,
+                      const std::size_t bytes, const std::size_t pixel_bytes,
+                      std::uint8_t *filtered){
+        const auto predict = [&](const int type, const std::size_t i){
+          const int left{i >= pixel_bytes ? row[i - pixel_bytes] : 0};
+          const int up{previous != nullptr ? previous[i] : 0};
+          const int up_left{previous != nullptr && i >= pixel_bytes ?
+                            previous[i - pixel_bytes] : 0};
+          switch(type){
+            case 1: return left;
+            case 2: return up;
+            case 3: return (left + up) / 2;
+            case 4: return static_cast<int>(paeth(left, up, up_left));
+            default: return 0;
+          }
+        };
+
+        int best_type{0};
+        std::size_t best_sum{~std::size_t(0)};
+        for(int type = 0; type < 5; ++type){
+          std::size_t sum{0};
+          for(std::size_t i = 0; i < bytes && sum < best_sum; ++i)
+            sum += static_cast<std::size_t>(std::abs(static_cast<std::int8_t>(
+                                            row[i] - predict(type, i))));
+          if(sum < best_sum){
+            best_sum = sum;
+            best_type = type;
+          }
+        }
+
+        filtered[0] = static_cast<std::uint8_t>(best_type);
+        for(std::size_t i = 0; i < bytes; ++i)
+          filtered[i + 1] = static_cast<std::uint8_t>(row[i] - predict(best_type, i));
+      }
+
+      // Compresses until the input is consumed, and the flush is complete if any
+      bool deflate_all(z_stream &stream, std::vector<std::uint8_t> &output,
+                       std::size_t &used, const int flush){
+        for(;;){
+          if(used == output.size()) output.resize(output.size() * 2 + 4096);
+          stream.next_out = output.data() + used;
+          stream.avail_out = static_cast<uInt>(output.size() - used);
+          const int result{deflate(&stream, flush)};
+          used = output.size() - stream.avail_out;
+          if(result == Z_STREAM_ERROR) return false;
+
+          if(flush == Z_FINISH){
+            if(result == Z_STREAM_END) return true;
+          }else if(stream.avail_in == 0 && (flush == Z_NO_FLUSH || stream.avail_out != 0)){
+            return true;
+          }
+        }
+      }
+
+      bool write_chunk(std::FILE *file, const char *type,
+                       std::initializer_list<std::pair<const std::uint8_t*, std::size_t>> pieces){
+        std::size_t length{0};
+        for(const auto &piece : pieces)
+          length += piece.second;
+
+        std::uint8_t header[8];
+        put_big_endian(header, static_cast<std::uint32_t>(length));
+        std::memcpy(header + 4, type, 4);
+        uLong crc{crc32(0, header + 4, 4)};
+        bool success{std::fwrite(header, 1, 8, file) == 8};
+        for(const auto &piece : pieces){
+          if(piece.second == 0) continue;
+          crc = crc32(crc, piece.first, static_cast<uInt>(piece.second));
+          success = success && std::fwrite(piece.first, 1, piece.second, file) == piece.second;
+        }
+
+        std::uint8_t footer[4];
+        put_big_endian(footer, static_cast<std::uint32_t>(crc));
+        return success && std::fwrite(footer, 1, 4, file) == 4;
+      }
+#endif
+    }
+
+    struct image_encoder::job {
+      std::string path;
+      // owned pixels, empty when `data` is borrowed until `release` is called
+      std::vector<std::uint8_t> pixels;
+      const std::uint8_t *data;
+      release_callback release;
+      std::size_t width, height, row_bytes, channels;
+      bool swap, flip;
+      std::chrono::steady_clock::time_point queued;
+
+      // compressed PNG bands, their adler32 and filtered size
+      std::vector<std::vector<std::uint8_t>> bands;
+      std::vector<std::uint32_t> adlers;
+      std::vector<std::size_t> filtered_bytes;
+      std::atomic<std::size_t> bands_left;
+      std::atomic<bool> failed;
+      std::size_t file_bytes;
+
+      const std::uint8_t *row(const std::size_t index) const{
+        return data + (flip ? height - 1 - index : index) * row_bytes;
+      }
+    };
+
+    image_encoder::image_encoder(const std::size_t threads, const int compression_level) :
+      threads_(),
+      tasks_(),
+      mutex_(),
+      work_(),
+      idle_(),
+      pending_(0),
+      compression_level_(std::min(9, std::max(1, compression_level))),
+      stopping_(false),
+      statistics_()
+    {
+      const std::size_t count{threads > 0 ? threads :
+                              std::max<std::size_t>(1, std::thread::hardware_concurrency())};
+      for(std::size_t i = 0; i < count; ++i)
+        threads_.emplace_back(&image_encoder::worker, this);
+    }
+
+    image_encoder::~image_encoder(){
+      wait();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+      }
+      work_.notify_all();
+      for(std::thread &thread : threads_)
+        thread.join();
+    }
+
+    bool image_encoder::encode(const std::string &path, std::vector<std::uint8_t> &&pixels,
+                               const GLsizei width, const GLsizei height, const GLenum format,
+                               const bool flip, const image::format type,
+                               const std::size_t row_bytes){
+      if(!accepts(path, pixels.size(), width, height, format, type, row_bytes)) return false;
+
+      std::shared_ptr<job> image{std::make_shared<job>()};
+      image->pixels = std::move(pixels);
+      image->data = image->pixels.data();
+      queue(image, path, width, height, format, flip, type, row_bytes);
+      return true;
+    }
+
+    bool image_encoder::encode(const std::string &path, const void *pixels,
+                               const std::size_t size, const GLsizei width,
+                               const GLsizei height, const GLenum format, const bool flip,
+                               const image::format type, const std::size_t row_bytes,
+                               const release_callback &release){
+      if(pixels == nullptr
+         || !accepts(path, size, width, height, format, type, row_bytes)) return false;
+
+      std::shared_ptr<job> image{std::make_shared<job>()};
+      image->data = static_cast<const std::uint8_t*>(pixels);
+      image->release = release;
+      queue(image, path, width, height, format, flip, type, row_bytes);
+      return true;
+    }
+
+    bool image_encoder::encode(const std::string &path, const pooled_buffer &buffer,
+                               readback_pool &pool, const image::format type){
+      if(buffer.type != GL_UNSIGNED_BYTE) return false;
+      // read back rows go from the bottom of the image
+      return encode(path, buffer.data, buffer.size, buffer.width, buffer.height,
+                    buffer.format, true, type, buffer.row_bytes, [&pool, buffer]{
+        pool.recycle(buffer);
+      });
+    }
+
+    std::size_t image_encoder::pending() const{
+      std::lock_guard<std::mutex> lock(mutex_);
+      return pending_;
+    }
+
+    encoder_statistics image_encoder::statistics() const{
+      std::lock_guard<std::mutex> lock(mutex_);
+      return statistics_;
+    }
+
+    bool image_encoder::supports_png(){
+#ifdef RAMROD_GL_ZLIB
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    void image_encoder::wait(){
+      std::unique_lock<std::mutex> lock(mutex_);
+      idle_.wait(lock, [this]{ return pending_ == 0; });
+    }
+
+    bool image_encoder::accepts(const std::string &path, const std::size_t size,
+                                const GLsizei width, const GLsizei height,
+                                const GLenum format, const image::format type,
+                                const std::size_t row_bytes) const{
+      const std::size_t channels{format == GL_RGB || format == GL_BGR ? 3u :
+                                 format == GL_RGBA || format == GL_BGRA ? 4u : 0u};
+      if(channels == 0 || path.empty() || width <= 0 || height <= 0) return false;
+      if(type == image::format::png && !supports_png()) return false;
+
+      const std::size_t tight{static_cast<std::size_t>(width) * channels};
+      const std::size_t stride{row_bytes > 0 ? row_bytes : tight};
+      return stride >= tight && size >= stride * static_cast<std::size_t>(height - 1) + tight;
+    }
+
+    void image_encoder::encode_png_band(const std::shared_ptr<job> &image, const std::size_t band){
+#ifdef RAMROD_GL_ZLIB
+      const std::size_t count{image->bands.size()};
+      const std::size_t first{image->height * band / count};
+      const std::size_t last{image->height * (band + 1) / count};
+      const std::size_t bytes{image->width * image->channels};
+
+      std::vector<std::uint8_t> previous(bytes), current(bytes), filtered(bytes + 1);
+      // the first row of a band is filtered against the last row of the previous one
+      if(first > 0)
+        load_row(image->row(first - 1), previous.data(), image->width, image->channels,
+                 image->swap);
+
+      z_stream stream{};
+      bool success{deflateInit2(&stream, compression_level_, Z_DEFLATED, -15, 8,
+                                Z_DEFAULT_STRATEGY) == Z_OK};
+      std::vector<std::uint8_t> &output{image->bands[band]};
+      std::size_t used{0};
+      uLong adler{adler32(0, nullptr, 0)};
+      if(success)
+        output.resize(deflateBound(&stream, static_cast<uLong>((bytes + 1) * (last - first))));
+
+      for(std::size_t row = first; row < last && success; ++row){
+        load_row(image->row(row), current.data(), image->width, image->channels, image->swap);
+        filter_row(current.data(), row > 0 ? previous.data() : nullptr, bytes,
+                   image->channels, filtered.data());
+        adler = adler32(adler, filtered.data(), static_cast<uInt>(filtered.size()));
+        stream.next_in = filtered.data();
+        stream.avail_in = static_cast<uInt>(filtered.size());
+        success = deflate_all(stream, output, used, Z_NO_FLUSH);
+        previous.swap(current);
+      }
+      // a full flush ends the band on a byte boundary without a final block, so the
+      // raw deflate streams of the bands can be concatenated
+      if(success)
+        success = deflate_all(stream, output, used, band + 1 == count ? Z_FINISH : Z_FULL_FLUSH);
+      deflateEnd(&stream);
+
+      output.resize(used);
+      image->adlers[band] = static_cast<std::uint32_t>(adler);
+      image->filtered_bytes[band] = (bytes + 1) * (last - first);
+      if(!success) image->failed = true;
+#endif
+      if(image->bands_left.fetch_sub(1) == 1)
+        finish(image, !image->failed && write_png(*image));
+    }
+
+    void image_encoder::encode_qoi(const std::shared_ptr<job> &image){
+      const std::size_t channels{image->channels};
+      std::vector<std::uint8_t> output;
+      output.reserve(14 + image->width * image->height * (channels + 1) + 8);
+
+      std::uint8_t header[14]{'q', 'o', 'i', 'f'};
+      put_big_endian(header + 4, static_cast<std::uint32_t>(image->width));
+      put_big_endian(header + 8, static_cast<std::uint32_t>(image->height));
+      header[12] = static_cast<std::uint8_t>(channels);
+      header[13] = 0;
+      output.insert(output.end(), header, header + 14);
+
+      std::uint8_t index[64][4]{};
+      std::uint8_t previous[4]{0, 0, 0, 255};
+      std::uint8_t pixel[4]{0, 0, 0, 255};
+      std::size_t run{0};
+      std::vector<std::uint8_t> row(image->width * channels);
+      const std::size_t total{image->width * image->height};
+
+      for(std::size_t y = 0, position = 0; y < image->height; ++y){
+        load_row(image->row(y), row.data(), image->width, channels, image->swap);
+        for(std::size_t x = 0; x < image->width; ++x, ++position){
+          std::memcpy(pixel, row.data() + x * channels, channels);
+
+          if(std::memcmp(pixel, previous, 4) == 0){
+            ++run;
+            if(run == 62 || position + 1 == total){
+              output.push_back(static_cast<std::uint8_t>(0xC0 | (run - 1)));
+              run = 0;
+            }
+            continue;
+          }
+          if(run > 0){
+            output.push_back(static_cast<std::uint8_t>(0xC0 | (run - 1)));
+            run = 0;
+          }
+
+          const std::size_t hash{(pixel[0] * 3u + pixel[1] * 5u + pixel[2] * 7u
+                                  + pixel[3] * 11u) % 64u};
+          if(std::memcmp(index[hash], pixel, 4) == 0){
+            output.push_back(static_cast<std::uint8_t>(hash));
+          }else{
+            std::memcpy(index[hash], pixel, 4);
+            if(pixel[3] == previous[3]){
+              const int red{static_cast<std::int8_t>(pixel[0] - previous[0])};
+              const int green{static_cast<std::int8_t>(pixel[1] - previous[1])};
+              const int blue{static_cast<std::int8_t>(pixel[2] - previous[2])};
+              const int red_green{red - green}, blue_green{blue - green};
+
+              if(red > -3 && red < 2 && green > -3 && green < 2 && blue > -3 && blue < 2){
+                output.push_back(static_cast<std::uint8_t>(0x40 | (red + 2) << 4
+                                                           | (green + 2) << 2 | (blue + 2)));
+              }else if(red_green > -9 && red_green < 8 && green > -33 && green < 32
+                       && blue_green > -9 && blue_green < 8){
+                output.push_back(static_cast<std::uint8_t>(0x80 | (green + 32)));
+                output.push_back(static_cast<std::uint8_t>((red_green + 8) << 4
+                                                           | (blue_green + 8)));
+              }else{
+                output.insert(output.end(), {0xFE, pixel[0], pixel[1], pixel[2]});
+              }
+            }else{
+              output.insert(output.end(), {0xFF, pixel[0], pixel[1], pixel[2], pixel[3]});
+            }
+          }
+          std::memcpy(previous, pixel, 4);
+        }
+      }
+      output.insert(output.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+
+      std::FILE *file{std::fopen(image->path.c_str(), "wb")};
+      bool success{file != nullptr
+                   && std::fwrite(output.data(), 1, output.size(), file) == output.size()};
+      if(file != nullptr && std::fclose(file) != 0) success = false;
+      image->file_bytes = output.size();
+      finish(image, success);
+    }
+
+    void image_encoder::finish(const std::shared_ptr<job> &image, const bool success){
+      const double milliseconds{std::chrono::duration<double, std::milli>(
+                                  std::chrono::steady_clock::now() - image->queued).count()};
+      // the pixels can be big, they are freed before waking the waiting threads
+      image->pixels = std::vector<std::uint8_t>();
+      image->data = nullptr;
+      if(image->release){
+        image->release();
+        image->release = nullptr;
+      }
+      image->bands.clear();
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(success){
+          ++statistics_.encoded;
+          statistics_.written_bytes += image->file_bytes;
+          statistics_.last_milliseconds = milliseconds;
+        }else{
+          ++statistics_.failed;
+        }
+        --pending_;
+      }
+      idle_.notify_all();
+    }
+
+    void image_encoder::queue(const std::shared_ptr<job> &image, const std::string &path,
+                              const GLsizei width, const GLsizei height, const GLenum format,
+                              const bool flip, const image::format type,
+                              const std::size_t row_bytes){
+      image->path = path;
+      image->width = static_cast<std::size_t>(width);
+      image->height = static_cast<std::size_t>(height);
+      image->channels = format == GL_RGB || format == GL_BGR ? 3 : 4;
+      image->row_bytes = row_bytes > 0 ? row_bytes : image->width * image->channels;
+      image->swap = format == GL_BGR || format == GL_BGRA;
+      image->flip = flip;
+      image->queued = std::chrono::steady_clock::now();
+      image->failed = false;
+      image->file_bytes = 0;
+
+      std::size_t bands{1};
+      if(type == image::format::png)
+        bands = std::max<std::size_t>(1, std::min(threads_.size(),
+                                                  image->height / minimum_band_rows));
+      image->bands.resize(bands);
+      image->adlers.resize(bands, 1);
+      image->filtered_bytes.resize(bands, 0);
+      image->bands_left = bands;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++pending_;
+        ++statistics_.queued;
+        if(type == image::format::qoi){
+          tasks_.emplace_back([this, image]{ encode_qoi(image); });
+        }else{
+          for(std::size_t band = 0; band < bands; ++band)
+            tasks_.emplace_back([this, image, band]{ encode_png_band(image, band); });
+        }
+      }
+      if(bands > 1) work_.notify_all();
+      else work_.notify_one();
+    }
+
+    void image_encoder::worker(){
+      std::unique_lock<std::mutex> lock(mutex_);
+      for(;;){
+        work_.wait(lock, [this]{ return stopping_ || !tasks_.empty(); });
+        if(tasks_.empty()) return;
+
+        std::function<void()> task{std::move(tasks_.front())};
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+      }
+    }
+
+    bool image_encoder::write_png(job &image){
+#ifdef RAMROD_GL_ZLIB
+      std::FILE *file{std::fopen(image.path.c_str(), "wb")};
+      if(file == nullptr) return false;
+
+      static const std::uint8_t signature[8]{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+      std::uint8_t header[13];
+      put_big_endian(header, static_cast<std::uint32_t>(image.width));
+      put_big_endian(header + 4, static_cast<std::uint32_t>(image.height));
+      header[8] = 8;
+      header[9] = image.channels == 4 ? 6 : 2;
+      header[10] = header[11] = header[12] = 0;
+
+      uLong adler{image.adlers[0]};
+      for(std::size_t band = 1; band < image.bands.size(); ++band)
+        adler = adler32_combine(adler, image.adlers[band],
+                                static_cast<z_off_t>(image.filtered_bytes[band]));
+      static const std::uint8_t zlib_header[2]{0x78, 0x9C};
+      std::uint8_t zlib_footer[4];
+      put_big_endian(zlib_footer, static_cast<std::uint32_t>(adler));
+
+      bool success{std::fwrite(signature, 1, 8, file) == 8
+                   && write_chunk(file, "IHDR", {{header, 13}})};
+      image.file_bytes = 8 + 25 + 12;
+      // one IDAT chunk per band, together they hold a single zlib stream
+      for(std::size_t band = 0; band < image.bands.size() && success; ++band){
+        const bool first{band == 0}, last{band + 1 == image.bands.size()};
+        success = write_chunk(file, "IDAT", {{zlib_header, first ? 2 : 0},
+                                             {image.bands[band].data(), image.bands[band].size()},
+                                             {zlib_footer, last ? 4 : 0}});
+        image.file_bytes += 12 + image.bands[band].size() + (first ? 2 : 0) + (last ? 4 : 0);
+      }
+      success = success && write_chunk(file, "IEND", {});
+      if(std::fclose(file) != 0) success = false;
+      return success;
+#else
+      static_cast<void>(image);
+      return false;
+#endif
+    }
+  } // namespace: gl
+} // namespace: ramrod
@@ -0,0 +1,177 @@
+#include "ramrod/gl/picker.h"
+
+#include <algorithm>
+
+#include "ramrod/gl/pixel_conversion.h"
+
+namespace ramrod {
+  namespace gl {
+    picker::picker(const std::uint32_t background, const std::size_t requests) :
+      background_(background),
+      identifiers_(false, 0, false),
+      depth_(false),
+      frame_(false),
+      readbacks_(requests),
+      values_(),
+      unique_(),
+      counts_(),
+      width_(0),
+      height_(0),
+      previous_frame_buffer_(0),
+      previous_viewport_{0, 0, 0, 0},
+      in_pass_(false)
+    {}
+
+    picker::~picker(){}
+
+    bool picker::begin(){
+      if(width_ == 0 || in_pass_) return false;
+
+      glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_frame_buffer_);
+      glGetIntegerv(GL_VIEWPORT, previous_viewport_);
+
+      frame_.bind();
+      glViewport(0, 0, width_, height_);
+      const GLuint clear_identifier[4]{background_, 0, 0, 0};
+      glClearBufferuiv(GL_COLOR, 0, clear_identifier);
+      glClearBufferfi(GL_DEPTH_STENCIL, 0, 1.0f, 0);
+      in_pass_ = true;
+      return true;
+    }
+
+    std::uint32_t picker::background() const{
+      return background_;
+    }
+
+    bool picker::cancel(const std::uint64_t ticket){
+      return readbacks_.cancel(ticket);
+    }
+
+    bool picker::end(){
+      if(!in_pass_) return false;
+      in_pass_ = false;
+
+      const GLenum depth_attachment{GL_DEPTH_STENCIL_ATTACHMENT};
+      frame_.invalidate(1, &depth_attachment);
+
+      glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_frame_buffer_));
+      glViewport(previous_viewport_[0], previous_viewport_[1],
+                 previous_viewport_[2], previous_viewport_[3]);
+      return true;
+    }
+
+    frame_buffer &picker::frame(){
+      return frame_;
+    }
+
+    GLsizei picker::height() const{
+      return height_;
+    }
+
+    texture_2d &picker::identifiers(){
+      return identifiers_;
+    }
+
+    bool picker::is_ready(const std::uint64_t ticket){
+      return readbacks_.is_ready(ticket);
+    }
+
+    std::uint64_t picker::pick(const GLint x, const GLint y){
+      if(x < 0 || y < 0 || x >= width_ || y >= height_) return 0;
+      return readbacks_.read(frame_, GL_COLOR_ATTACHMENT0, x, y, 1, 1,
+                             GL_RED_INTEGER, GL_UNSIGNED_INT);
+    }
+
+    bool picker::resize(const GLsizei width, const GLsizei height){
+      if(width <= 0 || height <= 0 || in_pass_) return false;
+      if(width == width_ && height == height_) return true;
+
+      // immutable storage cannot be resized, the objects are created again
+      identifiers_.delete_texture();
+      depth_.delete_buffer();
+      frame_.delete_frame();
+      width_ = height_ = 0;
+
+      GLint previous_frame_buffer{0};
+      glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_frame_buffer);
+
+      identifiers_.generate();
+      identifiers_.bind();
+      identifiers_.storage(1, GL_R32UI, width, height);
+      // integer textures are not filterable
+      identifiers_.parameter(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_NEAREST, GL_NEAREST);
+      identifiers_.release();
+
+      depth_.generate();
+      depth_.bind();
+      depth_.storage(width, height, GL_DEPTH24_STENCIL8);
+      depth_.release();
+
+      frame_.generate_frame();
+      frame_.bind();
+      frame_.attach_texture(identifiers_);
+      depth_.attach_render_to_framebuffer(GL_DEPTH_STENCIL_ATTACHMENT);
+      frame_.draw_buffer();
+      const bool complete{frame_.status() == GL_FRAMEBUFFER_COMPLETE};
+      glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_frame_buffer));
+
+      if(!complete) return false;
+      width_ = width;
+      height_ = height;
+      return true;
+    }
+
+    bool picker::result(const std::uint64_t ticket, std::uint32_t &identifier, const bool wait){
+      if(readbacks_.size(ticket) < sizeof(std::uint32_t)) return false;
+
+      values_.resize(readbacks_.size(ticket) / sizeof(std::uint32_t));
+      if(!readbacks_.fetch(ticket, values_.data(), wait)) return false;
+      identifier = values_.front();
+      return true;
+    }
+
+    bool picker::result(const std::uint64_t ticket, std::vector<std::uint32_t> &identifiers,
+                        std::vector<std::uint32_t> *pixels, const bool wait){
+      const std::size_t count{readbacks_.size(ticket) / sizeof(std::uint32_t)};
+      if(count == 0) return false;
+
+      values_.resize(count);
+      if(!readbacks_.fetch(ticket, values_.data(), wait)) return false;
+
+      unique_.resize(count);
+      counts_.resize(count);
+      const std::size_t distinct{pixel::histogram(values_.data(), count,
+                                                  unique_.data(), counts_.data())};
+
+      identifiers.clear();
+      if(pixels != nullptr) pixels->clear();
+      for(std::size_t i = 0; i < distinct; ++i){
+        if(unique_[i] == background_) continue;
+        identifiers.push_back(unique_[i]);
+        if(pixels != nullptr) pixels->push_back(counts_[i]);
+      }
+      return true;
+    }
+
+    std::uint64_t picker::select(GLint x, GLint y, GLsizei width, GLsizei height){
+      if(x < 0){
+        width += x;
+        x = 0;
+      }
+      if(y < 0){
+        height += y;
+        y = 0;
+      }
+      width = std::min(width, width_ - x);
+      height = std::min(height, height_ - y);
+      if(width <= 0 || height <= 0) return 0;
+
+      return readbacks_.read(frame_, GL_COLOR_ATTACHMENT0, x, y, width, height,
+                             GL_RED_INTEGER, GL_UNSIGNED_INT);
+    }
+
+    GLsizei picker::width() const{
+      return width_;
+    }
+  } // namespace: gl
+} // namespace: ramrod
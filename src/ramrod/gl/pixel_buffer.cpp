@@ -1,5 +1,9 @@
 #include "ramrod/gl/pixel_buffer.h"
 
+#include <cstdint>
+
+#include "ramrod/gl/pixel_conversion.h"
+
 namespace ramrod {
   namespace gl {
     pixel_buffer::pixel_buffer(const bool generate, const pixel::buffer type) :
@@ -28,6 +32,37 @@ namespace ramrod {
       return true;
     }
 
+    bool pixel_buffer::copy_rgba(void *destination, const GLsizei width, const GLsizei height,
+                                 const bool top_to_bottom){
+      if(buffer_id_ == 0 || destination == nullptr || width <= 0 || height <= 0) return false;
+
+      // rows were packed by glReadPixels with the current pack parameters
+      GLint alignment{4}, row_length{0}, skip_pixels{0}, skip_rows{0};
+      glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+      glGetIntegerv(GL_PACK_ROW_LENGTH, &row_length);
+      glGetIntegerv(GL_PACK_SKIP_PIXELS, &skip_pixels);
+      glGetIntegerv(GL_PACK_SKIP_ROWS, &skip_rows);
+      const std::size_t align{static_cast<std::size_t>(alignment > 0 ? alignment : 1)};
+      const std::size_t pixels{static_cast<std::size_t>(row_length > 0 ? row_length : width)};
+      const std::size_t stride{(pixels * 4 + align - 1) / align * align};
+      const std::size_t first{static_cast<std::size_t>(skip_rows) * stride
+                              + static_cast<std::size_t>(skip_pixels) * 4};
+      const std::size_t row_bytes{static_cast<std::size_t>(width) * 4};
+
+      const void *data{map_range(0, static_cast<GLsizeiptr>(first + stride * (height - 1)
+                                                            + row_bytes))};
+      if(data == nullptr) return false;
+
+      const std::uint8_t *source{static_cast<const std::uint8_t*>(data) + first};
+      std::uint8_t *target{static_cast<std::uint8_t*>(destination)};
+      for(GLsizei row = 0; row < height; ++row){
+        const GLsizei target_row{top_to_bottom ? height - 1 - row : row};
+        pixel::swap_red_blue(source + stride * row, target + row_bytes * target_row,
+                             static_cast<std::size_t>(width));
+      }
+      return unmap();
+    }
+
     bool pixel_buffer::generate(){
       if(buffer_id_ > 0) return false;
       glGenBuffers(1, &buffer_id_);
@@ -60,6 +95,20 @@ namespace ramrod {
       return glMapBufferRange(buffer_type_, offset, length, access);
     }
 
+    void *pixel_buffer::map_range_when_ready(sync &ready, const GLintptr offset,
+                                             const GLsizeiptr length, const GLenum access,
+                                             const GLuint64 timeout){
+      const fence::status status{ready.wait(timeout)};
+      if(status == fence::status::timeout || status == fence::status::failed) return nullptr;
+      return map_range(offset, length, access);
+    }
+
+    void *pixel_buffer::map_when_ready(sync &ready, const GLenum access, const GLuint64 timeout){
+      const fence::status status{ready.wait(timeout)};
+      if(status == fence::status::timeout || status == fence::status::failed) return nullptr;
+      return map(access);
+    }
+
     void pixel_buffer::read_buffer(const GLenum mode){
       glReadBuffer(mode);
     }
@@ -0,0 +1,900 @@
+#include "ramrod/gl/pixel_conversion.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// The SIMD paths are compiled with target attributes and picked at run time, so the
+// library does not need to be built with -mavx2
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define RAMROD_GL_PIXEL_CONVERSION_X86
+#endif
+
+namespace ramrod {
+  namespace gl {
+    namespace pixel {
+      namespace {
+        // linear values are quantized to this many steps before looking up their sRGB
+        // value, enough to stay within one step of the exact curve near black
+        constexpr std::size_t srgb_steps{4096};
+
+        struct srgb_tables {
+          float decode[256];
+          // 3 bytes of padding so 32 bits gathers of the last entry stay inside
+          std::uint8_t encode[srgb_steps + 3];
+
+          srgb_tables(){
+            for(std::size_t value = 0; value < 256; ++value){
+              const float encoded{static_cast<float>(value) / 255.0f};
+              decode[value] = encoded <= 0.04045f ? encoded / 12.92f :
+                                                    std::pow((encoded + 0.055f) / 1.055f, 2.4f);
+            }
+            for(std::size_t step = 0; step < srgb_steps; ++step){
+              const float linear{static_cast<float>(step) / (srgb_steps - 1)};
+              const float encoded{linear <= 0.0031308f ? linear * 12.92f :
+                                  1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f};
+              encode[step] = static_cast<std::uint8_t>(std::lround(encoded * 255.0f));
+            }
+            encode[srgb_steps] = encode[srgb_steps + 1] = encode[srgb_steps + 2] = 255;
+          }
+        };
+
+        const srgb_tables &tables(){
+          static const srgb_tables instance;
+          return instance;
+        }
+
+        simd detect(){
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+          __builtin_cpu_init();
+          if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c"))
+            return simd::avx2;
+          if(__builtin_cpu_supports("sse2"))
+            return simd::sse2;
+#endif
+          return simd::scalar;
+        }
+
+        simd supported(){
+          static const simd best{detect()};
+          return best;
+        }
+
+        std::atomic<unsigned int> maximum_set{static_cast<unsigned int>(simd::avx2)};
+
+        // Scalar implementations, also used for the remaining pixels of the SIMD ones
+
+        void rgb_to_rgba_scalar(const std::uint8_t *rgb, std::uint8_t *rgba,
+                                const std::size_t pixels, const std::uint8_t alpha){
+          for(std::size_t i = 0; i < pixels; ++i, rgb += 3, rgba += 4){
+            rgba[0] = rgb[0];
+            rgba[1] = rgb[1];
+            rgba[2] = rgb[2];
+            rgba[3] = alpha;
+          }
+        }
+
+        void rgba_to_rgb_scalar(const std::uint8_t *rgba, std::uint8_t *rgb,
+                                const std::size_t pixels){
+          for(std::size_t i = 0; i < pixels; ++i, rgb += 3, rgba += 4){
+            rgb[0] = rgba[0];
+            rgb[1] = rgba[1];
+            rgb[2] = rgba[2];
+          }
+        }
+
+        void swap_red_blue_scalar(const std::uint8_t *source, std::uint8_t *destination,
+                                  const std::size_t pixels){
+          for(std::size_t i = 0; i < pixels; ++i){
+            std::uint32_t value;
+            std::memcpy(&value, source + i * 4, 4);
+            value = (value & 0xFF00FF00u) | ((value >> 16) & 0xFFu) | ((value & 0xFFu) << 16);
+            std::memcpy(destination + i * 4, &value, 4);
+          }
+        }
+
+        // Tile hashes accumulate 32 bytes stripes into 4 lanes of 64 bits. Every lane
+        // adds the product of the halves of its value mixed with a key, and the plain
+        // value of its neighbour; the keys advance every stripe so the position of the
+        // bytes counts. Only 32 x 32 bits products are used, which SSE2 and AVX2 have.
+        constexpr std::uint64_t hash_keys[4]{
+          0xBE4BA423396CFEB8ull, 0x1CAD21F72C81017Cull,
+          0xDB979083E96DD4DEull, 0x1F67B3B7A4A44072ull
+        };
+        constexpr std::uint64_t hash_key_step{0x9E3779B97F4A7C15ull};
+
+        struct hash_state {
+          std::uint64_t lanes[4];
+          std::uint64_t keys[4];
+        };
+
+        void hash_stripe_scalar(const std::uint8_t *stripe, hash_state &state){
+          std::uint64_t value[4];
+          std::memcpy(value, stripe, 32);
+          for(std::size_t lane = 0; lane < 4; ++lane){
+            const std::uint64_t keyed{value[lane] ^ state.keys[lane]};
+            state.lanes[lane] += (keyed & 0xFFFFFFFFu) * (keyed >> 32);
+            state.lanes[lane ^ 1] += value[lane];
+            state.keys[lane] += hash_key_step;
+          }
+        }
+
+        std::uint64_t mix_scalar(std::uint64_t value){
+          value ^= value >> 33;
+          value *= 0xFF51AFD7ED558CCDull;
+          value ^= value >> 33;
+          value *= 0xC4CEB9FE1A85EC53ull;
+          return value ^ (value >> 33);
+        }
+
+        std::uint16_t half_scalar(const float value){
+          std::uint32_t bits;
+          std::memcpy(&bits, &value, 4);
+          const std::uint32_t sign{(bits >> 16) & 0x8000u};
+          bits &= 0x7FFFFFFFu;
+
+          std::uint32_t half;
+          if(bits >= 0x47800000u){
+            // infinity, NaN or too big for a half
+            half = bits > 0x7F800000u ? 0x7E00u : 0x7C00u;
+          }else if(bits < 0x38800000u){
+            // subnormal half: the addition rounds the mantissa into place
+            float shifted;
+            std::memcpy(&shifted, &bits, 4);
+            shifted += 0.5f;
+            std::memcpy(&half, &shifted, 4);
+            half -= 0x3F000000u;
+          }else{
+            const std::uint32_t odd{(bits >> 13) & 1u};
+            bits += 0xC8000FFFu + odd;
+            half = bits >> 13;
+          }
+          return static_cast<std::uint16_t>(half | sign);
+        }
+
+        float float_scalar(const std::uint16_t half){
+          constexpr std::uint32_t shifted_exponent{0x7C00u << 13};
+          std::uint32_t bits{static_cast<std::uint32_t>(half & 0x7FFFu) << 13};
+          const std::uint32_t exponent{bits & shifted_exponent};
+          bits += (127u - 15u) << 23;
+
+          float value;
+          if(exponent == shifted_exponent){
+            // infinity or NaN
+            bits += (128u - 16u) << 23;
+            std::memcpy(&value, &bits, 4);
+          }else if(exponent == 0){
+            // zero or subnormal
+            bits += 1u << 23;
+            std::memcpy(&value, &bits, 4);
+            value -= 6.103515625e-05f;
+          }else{
+            std::memcpy(&value, &bits, 4);
+          }
+
+          std::memcpy(&bits, &value, 4);
+          bits |= static_cast<std::uint32_t>(half & 0x8000u) << 16;
+          std::memcpy(&value, &bits, 4);
+          return value;
+        }
+
+        std::uint8_t srgb_scalar(const float linear, const std::uint8_t *encode){
+          const float clamped{linear > 0.0f ? (linear < 1.0f ? linear : 1.0f) : 0.0f};
+          return encode[static_cast<std::size_t>(clamped * (srgb_steps - 1) + 0.5f)];
+        }
+
+        // BT.601 limited range in 8 bits fixed point
+        inline std::uint8_t luma(const int blue, const int green, const int red){
+          return static_cast<std::uint8_t>(((66 * red + 129 * green + 25 * blue + 128) >> 8) + 16);
+        }
+
+        inline std::uint8_t blue_difference(const int blue, const int green, const int red){
+          return static_cast<std::uint8_t>(((112 * blue - 74 * green - 38 * red + 128) >> 8) + 128);
+        }
+
+        inline std::uint8_t red_difference(const int blue, const int green, const int red){
+          return static_cast<std::uint8_t>(((112 * red - 94 * green - 18 * blue + 128) >> 8) + 128);
+        }
+
+        // Converts a pair of rows from pixel `i`, the chroma samples are `step` bytes apart
+        void yuv420_rows_scalar(const std::uint8_t *top, const std::uint8_t *bottom,
+                                std::size_t i, const std::size_t width,
+                                std::uint8_t *y_top, std::uint8_t *y_bottom,
+                                std::uint8_t *u, std::uint8_t *v, const std::size_t step){
+          for(; i < width; i += 2){
+            const std::size_t next{i + 1 < width ? i + 1 : i};
+            const std::uint8_t *pixels[4]{top + i * 4, top + next * 4,
+                                          bottom + i * 4, bottom + next * 4};
+            int blue{2}, green{2}, red{2};
+            for(const std::uint8_t *pixel : pixels){
+              blue += pixel[0];
+              green += pixel[1];
+              red += pixel[2];
+            }
+
+            y_top[i] = luma(pixels[0][0], pixels[0][1], pixels[0][2]);
+            y_top[next] = luma(pixels[1][0], pixels[1][1], pixels[1][2]);
+            y_bottom[i] = luma(pixels[2][0], pixels[2][1], pixels[2][2]);
+            y_bottom[next] = luma(pixels[3][0], pixels[3][1], pixels[3][2]);
+            u[i / 2 * step] = blue_difference(blue >> 2, green >> 2, red >> 2);
+            v[i / 2 * step] = red_difference(blue >> 2, green >> 2, red >> 2);
+          }
+        }
+
+        // Adds the index of every value different from the previous one
+        void run_starts_scalar(const std::uint32_t *values, std::size_t i,
+                               const std::size_t count, std::vector<std::size_t> &starts){
+          for(; i < count; ++i)
+            if(values[i] != values[i - 1]) starts.push_back(i);
+        }
+
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        // Splits 8 BGRA pixels into 16 bits channels
+        __attribute__((target("sse2")))
+        inline void split_sse2(const std::uint8_t *bgra, __m128i &blue, __m128i &green,
+                               __m128i &red){
+          const __m128i low{_mm_set1_epi32(0xFF)};
+          const __m128i first{_mm_loadu_si128(reinterpret_cast<const __m128i*>(bgra))};
+          const __m128i second{_mm_loadu_si128(reinterpret_cast<const __m128i*>(bgra + 16))};
+          blue = _mm_packs_epi32(_mm_and_si128(first, low), _mm_and_si128(second, low));
+          green = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(first, 8), low),
+                                  _mm_and_si128(_mm_srli_epi32(second, 8), low));
+          red = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(first, 16), low),
+                                _mm_and_si128(_mm_srli_epi32(second, 16), low));
+        }
+
+        // The products of the luma fit in unsigned 16 bits, the ones of the chroma in
+        // signed 16 bits
+        __attribute__((target("sse2")))
+        inline __m128i luma_sse2(const __m128i blue, const __m128i green, const __m128i red){
+          const __m128i sum{_mm_add_epi16(
+            _mm_add_epi16(_mm_mullo_epi16(red, _mm_set1_epi16(66)),
+                          _mm_mullo_epi16(green, _mm_set1_epi16(129))),
+            _mm_add_epi16(_mm_mullo_epi16(blue, _mm_set1_epi16(25)), _mm_set1_epi16(128)))};
+          return _mm_add_epi16(_mm_srli_epi16(sum, 8), _mm_set1_epi16(16));
+        }
+
+        __attribute__((target("sse2")))
+        inline __m128i chroma_sse2(const __m128i first, const __m128i second,
+                                   const __m128i third, const __m128i a, const __m128i b,
+                                   const __m128i c){
+          const __m128i sum{_mm_add_epi16(
+            _mm_add_epi16(_mm_mullo_epi16(first, a), _mm_mullo_epi16(second, b)),
+            _mm_add_epi16(_mm_mullo_epi16(third, c), _mm_set1_epi16(128)))};
+          return _mm_add_epi16(_mm_srai_epi16(sum, 8), _mm_set1_epi16(128));
+        }
+
+        // Sums the 2x2 blocks of 8 pixels of two rows into 4 values in 32 bits
+        __attribute__((target("sse2")))
+        inline __m128i block_sums_sse2(const __m128i top, const __m128i bottom){
+          return _mm_madd_epi16(_mm_add_epi16(top, bottom), _mm_set1_epi16(1));
+        }
+
+        __attribute__((target("sse2")))
+        std::size_t yuv420_rows_sse2(const std::uint8_t *top, const std::uint8_t *bottom,
+                                     const std::size_t width,
+                                     std::uint8_t *y_top, std::uint8_t *y_bottom,
+                                     std::uint8_t *u, std::uint8_t *v, const std::size_t step){
+          const __m128i two{_mm_set1_epi16(2)};
+          std::size_t i{0};
+
+          for(; i + 16 <= width; i += 16){
+            __m128i blue[4], green[4], red[4];
+            split_sse2(top + i * 4, blue[0], green[0], red[0]);
+            split_sse2(top + i * 4 + 32, blue[1], green[1], red[1]);
+            split_sse2(bottom + i * 4, blue[2], green[2], red[2]);
+            split_sse2(bottom + i * 4 + 32, blue[3], green[3], red[3]);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(y_top + i),
+                             _mm_packus_epi16(luma_sse2(blue[0], green[0], red[0]),
+                                              luma_sse2(blue[1], green[1], red[1])));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(y_bottom + i),
+                             _mm_packus_epi16(luma_sse2(blue[2], green[2], red[2]),
+                                              luma_sse2(blue[3], green[3], red[3])));
+
+            const __m128i block_blue{_mm_srli_epi16(_mm_add_epi16(_mm_packs_epi32(
+              block_sums_sse2(blue[0], blue[2]), block_sums_sse2(blue[1], blue[3])), two), 2)};
+            const __m128i block_green{_mm_srli_epi16(_mm_add_epi16(_mm_packs_epi32(
+              block_sums_sse2(green[0], green[2]), block_sums_sse2(green[1], green[3])), two), 2)};
+            const __m128i block_red{_mm_srli_epi16(_mm_add_epi16(_mm_packs_epi32(
+              block_sums_sse2(red[0], red[2]), block_sums_sse2(red[1], red[3])), two), 2)};
+            const __m128i blue_difference{chroma_sse2(block_blue, block_green, block_red,
+                                                      _mm_set1_epi16(112), _mm_set1_epi16(-74),
+                                                      _mm_set1_epi16(-38))};
+            const __m128i red_difference{chroma_sse2(block_red, block_green, block_blue,
+                                                     _mm_set1_epi16(112), _mm_set1_epi16(-94),
+                                                     _mm_set1_epi16(-18))};
+
+            if(step == 2){
+              _mm_storeu_si128(reinterpret_cast<__m128i*>(u + i),
+                               _mm_or_si128(blue_difference, _mm_slli_epi16(red_difference, 8)));
+            }else{
+              const __m128i planes{_mm_packus_epi16(blue_difference, red_difference)};
+              _mm_storel_epi64(reinterpret_cast<__m128i*>(u + i / 2), planes);
+              _mm_storel_epi64(reinterpret_cast<__m128i*>(v + i / 2), _mm_srli_si128(planes, 8));
+            }
+          }
+          return i;
+        }
+
+        __attribute__((target("sse2")))
+        std::size_t swap_red_blue_sse2(const std::uint8_t *source, std::uint8_t *destination,
+                                       const std::size_t pixels){
+          const __m128i green_alpha{_mm_set1_epi32(static_cast<int>(0xFF00FF00u))};
+          const __m128i low{_mm_set1_epi32(0xFF)};
+          const __m128i third{_mm_set1_epi32(0xFF0000)};
+          std::size_t i{0};
+
+          for(; i + 4 <= pixels; i += 4){
+            const __m128i value{_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4))};
+            const __m128i swapped{_mm_or_si128(_mm_and_si128(value, green_alpha),
+                                  _mm_or_si128(_mm_and_si128(_mm_srli_epi32(value, 16), low),
+                                               _mm_and_si128(_mm_slli_epi32(value, 16), third)))};
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), swapped);
+          }
+          return i;
+        }
+
+        __attribute__((target("sse2")))
+        std::size_t hash_stripes_sse2(const std::uint8_t *bytes, const std::size_t size,
+                                      hash_state &state){
+          __m128i low{_mm_loadu_si128(reinterpret_cast<const __m128i*>(state.lanes))};
+          __m128i high{_mm_loadu_si128(reinterpret_cast<const __m128i*>(state.lanes + 2))};
+          __m128i low_keys{_mm_loadu_si128(reinterpret_cast<const __m128i*>(state.keys))};
+          __m128i high_keys{_mm_loadu_si128(reinterpret_cast<const __m128i*>(state.keys + 2))};
+          const __m128i step{_mm_set1_epi64x(static_cast<long long>(hash_key_step))};
+          std::size_t i{0};
+
+          for(; i + 32 <= size; i += 32){
+            const __m128i first{_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i))};
+            const __m128i second{_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 16))};
+            const __m128i first_keyed{_mm_xor_si128(first, low_keys)};
+            const __m128i second_keyed{_mm_xor_si128(second, high_keys)};
+            low = _mm_add_epi64(low, _mm_add_epi64(
+              _mm_mul_epu32(first_keyed, _mm_srli_epi64(first_keyed, 32)),
+              _mm_shuffle_epi32(first, _MM_SHUFFLE(1, 0, 3, 2))));
+            high = _mm_add_epi64(high, _mm_add_epi64(
+              _mm_mul_epu32(second_keyed, _mm_srli_epi64(second_keyed, 32)),
+              _mm_shuffle_epi32(second, _MM_SHUFFLE(1, 0, 3, 2))));
+            low_keys = _mm_add_epi64(low_keys, step);
+            high_keys = _mm_add_epi64(high_keys, step);
+          }
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(state.lanes), low);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(state.lanes + 2), high);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(state.keys), low_keys);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(state.keys + 2), high_keys);
+          return i;
+        }
+
+        __attribute__((target("sse2")))
+        std::size_t run_starts_sse2(const std::uint32_t *values, const std::size_t count,
+                                    std::vector<std::size_t> &starts){
+          std::size_t i{1};
+
+          for(; i + 4 <= count; i += 4){
+            const __m128i current{_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i))};
+            const __m128i previous{_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i - 1))};
+            unsigned int changed{~static_cast<unsigned int>(
+              _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(current, previous)))) & 0xFu};
+            while(changed != 0){
+              starts.push_back(i + static_cast<std::size_t>(__builtin_ctz(changed)));
+              changed &= changed - 1;
+            }
+          }
+          return i;
+        }
+
+        __attribute__((target("sse2")))
+        std::size_t to_srgb_sse2(const float *linear, std::uint8_t *srgb,
+                                 const std::size_t count, const std::uint8_t *encode){
+          const __m128 zero{_mm_setzero_ps()}, one{_mm_set1_ps(1.0f)};
+          const __m128 scale{_mm_set1_ps(srgb_steps - 1)}, half{_mm_set1_ps(0.5f)};
+          alignas(16) std::int32_t index[4];
+          std::size_t i{0};
+
+          for(; i + 4 <= count; i += 4){
+            // maximum first so NaN becomes 0
+            const __m128 clamped{_mm_min_ps(_mm_max_ps(_mm_loadu_ps(linear + i), zero), one)};
+            _mm_store_si128(reinterpret_cast<__m128i*>(index),
+                            _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, scale), half)));
+            srgb[i] = encode[index[0]];
+            srgb[i + 1] = encode[index[1]];
+            srgb[i + 2] = encode[index[2]];
+            srgb[i + 3] = encode[index[3]];
+          }
+          return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t rgb_to_rgba_avx2(const std::uint8_t *rgb, std::uint8_t *rgba,
+                                     const std::size_t pixels, const std::uint8_t alpha){
+          const __m256i shuffle{_mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1,
+                                                 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1,
+                                                 6, 7, 8, -1, 9, 10, 11, -1)};
+          const __m256i opaque{_mm256_set1_epi32(static_cast<int>(
+                               static_cast<std::uint32_t>(alpha) << 24))};
+          std::size_t i{0};
+
+          // the second load reads 4 bytes past the 8 pixels, hence the margin
+          for(; i + 10 <= pixels; i += 8){
+            const __m128i low{_mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + i * 3))};
+            const __m128i high{_mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + i * 3 + 12))};
+            const __m256i value{_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1)};
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(rgba + i * 4),
+                                _mm256_or_si256(_mm256_shuffle_epi8(value, shuffle), opaque));
+          }
+          return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t rgba_to_rgb_avx2(const std::uint8_t *rgba, std::uint8_t *rgb,
+                                     const std::size_t pixels){
+          const __m256i shuffle{_mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14,
+                                                 -1, -1, -1, -1, 0, 1, 2, 4, 5, 6, 8, 9,
+                                                 10, 12, 13, 14, -1, -1, -1, -1)};
+          std::size_t i{0};
+
+          // every store writes 4 bytes past its 4 pixels, the next store or the scalar
+          // tail overwrites them
+          for(; i + 10 <= pixels; i += 8){
+            const __m256i value{_mm256_shuffle_epi8(_mm256_loadu_si256(
+                                reinterpret_cast<const __m256i*>(rgba + i * 4)), shuffle)};
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(rgb + i * 3),
+                             _mm256_castsi256_si128(value));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(rgb + i * 3 + 12),
+                             _mm256_extracti128_si256(value, 1));
+          }
+          return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t run_starts_avx2(const std::uint32_t *values, const std::size_t count,
+                                    std::vector<std::size_t> &starts){
+          std::size_t i{1};
+
+          for(; i + 8 <= count; i += 8){
+            const __m256i current{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i))};
+            const __m256i previous{
+              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i - 1))};
+            unsigned int changed{~static_cast<unsigned int>(
+              _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(current, previous))))
+              & 0xFFu};
+            while(changed != 0){
+              starts.push_back(i + static_cast<std::size_t>(__builtin_ctz(changed)));
+              changed &= changed - 1;
+            }
+          }
+          return i;
+        }
+
+        // Splits 16 BGRA pixels into 16 bits channels, in order
+        __attribute__((target("avx2")))
+        inline void split_avx2(const std::uint8_t *bgra, __m256i &blue, __m256i &green,
+                               __m256i &red){
+          const __m256i low{_mm256_set1_epi32(0xFF)};
+          const __m256i first{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bgra))};
+          const __m256i second{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bgra + 32))};
+          // packing works inside 128 bits lanes, the permutation puts the quarters back
+          blue = _mm256_permute4x64_epi64(_mm256_packs_epi32(
+            _mm256_and_si256(first, low), _mm256_and_si256(second, low)), 0xD8);
+          green = _mm256_permute4x64_epi64(_mm256_packs_epi32(
+            _mm256_and_si256(_mm256_srli_epi32(first, 8), low),
+            _mm256_and_si256(_mm256_srli_epi32(second, 8), low)), 0xD8);
+          red = _mm256_permute4x64_epi64(_mm256_packs_epi32(
+            _mm256_and_si256(_mm256_srli_epi32(first, 16), low),
+            _mm256_and_si256(_mm256_srli_epi32(second, 16), low)), 0xD8);
+        }
+
+        __attribute__((target("avx2")))
+        inline __m256i luma_avx2(const __m256i blue, const __m256i green, const __m256i red){
+          const __m256i sum{_mm256_add_epi16(
+            _mm256_add_epi16(_mm256_mullo_epi16(red, _mm256_set1_epi16(66)),
+                             _mm256_mullo_epi16(green, _mm256_set1_epi16(129))),
+            _mm256_add_epi16(_mm256_mullo_epi16(blue, _mm256_set1_epi16(25)),
+                             _mm256_set1_epi16(128)))};
+          return _mm256_add_epi16(_mm256_srli_epi16(sum, 8), _mm256_set1_epi16(16));
+        }
+
+        __attribute__((target("avx2")))
+        inline __m256i chroma_avx2(const __m256i first, const __m256i second,
+                                   const __m256i third, const __m256i a, const __m256i b,
+                                   const __m256i c){
+          const __m256i sum{_mm256_add_epi16(
+            _mm256_add_epi16(_mm256_mullo_epi16(first, a), _mm256_mullo_epi16(second, b)),
+            _mm256_add_epi16(_mm256_mullo_epi16(third, c), _mm256_set1_epi16(128)))};
+          return _mm256_add_epi16(_mm256_srai_epi16(sum, 8), _mm256_set1_epi16(128));
+        }
+
+        // Averages the 2x2 blocks of 32 pixels of two rows into 16 values
+        __attribute__((target("avx2")))
+        inline __m256i block_average_avx2(const __m256i top_first, const __m256i top_second,
+                                          const __m256i bottom_first,
+                                          const __m256i bottom_second){
+          const __m256i one{_mm256_set1_epi16(1)};
+          const __m256i sums{_mm256_permute4x64_epi64(_mm256_packs_epi32(
+            _mm256_madd_epi16(_mm256_add_epi16(top_first, bottom_first), one),
+            _mm256_madd_epi16(_mm256_add_epi16(top_second, bottom_second), one)), 0xD8)};
+          return _mm256_srli_epi16(_mm256_add_epi16(sums, _mm256_set1_epi16(2)), 2);
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t yuv420_rows_avx2(const std::uint8_t *top, const std::uint8_t *bottom,
+                                     const std::size_t width,
+                                     std::uint8_t *y_top, std::uint8_t *y_bottom,
+                                     std::uint8_t *u, std::uint8_t *v, const std::size_t step){
+          std::size_t i{0};
+
+          for(; i + 32 <= width; i += 32){
+            __m256i blue[4], green[4], red[4];
+            split_avx2(top + i * 4, blue[0], green[0], red[0]);
+            split_avx2(top + i * 4 + 64, blue[1], green[1], red[1]);
+            split_avx2(bottom + i * 4, blue[2], green[2], red[2]);
+            split_avx2(bottom + i * 4 + 64, blue[3], green[3], red[3]);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(y_top + i),
+                                _mm256_permute4x64_epi64(_mm256_packus_epi16(
+                                  luma_avx2(blue[0], green[0], red[0]),
+                                  luma_avx2(blue[1], green[1], red[1])), 0xD8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(y_bottom + i),
+                                _mm256_permute4x64_epi64(_mm256_packus_epi16(
+                                  luma_avx2(blue[2], green[2], red[2]),
+                                  luma_avx2(blue[3], green[3], red[3])), 0xD8));
+
+            const __m256i block_blue{block_average_avx2(blue[0], blue[1], blue[2], blue[3])};
+            const __m256i block_green{block_average_avx2(green[0], green[1], green[2], green[3])};
+            const __m256i block_red{block_average_avx2(red[0], red[1], red[2], red[3])};
+            const __m256i blue_difference{chroma_avx2(block_blue, block_green, block_red,
+                                                      _mm256_set1_epi16(112),
+                                                      _mm256_set1_epi16(-74),
+                                                      _mm256_set1_epi16(-38))};
+            const __m256i red_difference{chroma_avx2(block_red, block_green, block_blue,
+                                                     _mm256_set1_epi16(112),
+                                                     _mm256_set1_epi16(-94),
+                                                     _mm256_set1_epi16(-18))};
+
+            if(step == 2){
+              _mm256_storeu_si256(reinterpret_cast<__m256i*>(u + i),
+                                  _mm256_or_si256(blue_difference,
+                                                  _mm256_slli_epi16(red_difference, 8)));
+            }else{
+              const __m256i planes{_mm256_permute4x64_epi64(
+                _mm256_packus_epi16(blue_difference, red_difference), 0xD8)};
+              _mm_storeu_si128(reinterpret_cast<__m128i*>(u + i / 2),
+                               _mm256_castsi256_si128(planes));
+              _mm_storeu_si128(reinterpret_cast<__m128i*>(v + i / 2),
+                               _mm256_extracti128_si256(planes, 1));
+            }
+          }
+          return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t swap_red_blue_avx2(const std::uint8_t *source, std::uint8_t *destination,
+                                       const std::size_t pixels){
+          const __m256i shuffle{_mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11,
+                                                 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4, 7,
+                                                 10, 9, 8, 11, 14, 13, 12, 15)};
+          std::size_t i{0};
+
+          for(; i + 8 <= pixels; i += 8){
+            const __m256i value{_mm256_loadu_si256(
+                                reinterpret_cast<const __m256i*>(source + i * 4))};
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i * 4),
+                                _mm256_shuffle_epi8(value, shuffle));
+          }
+          return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t hash_stripes_avx2(const std::uint8_t *bytes, const std::size_t size,
+                                      hash_state &state){
+          __m256i lanes{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(state.lanes))};
+          __m256i keys{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(state.keys))};
+          const __m256i step{_mm256_set1_epi64x(static_cast<long long>(hash_key_step))};
+          std::size_t i{0};
+
+          for(; i + 32 <= size; i += 32){
+            const __m256i value{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i))};
+            const __m256i keyed{_mm256_xor_si256(value, keys)};
+            lanes = _mm256_add_epi64(lanes, _mm256_add_epi64(
+              _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32)),
+              _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))));
+            keys = _mm256_add_epi64(keys, step);
+          }
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(state.lanes), lanes);
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(state.keys), keys);
+          return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t to_srgb_avx2(const float *linear, std::uint8_t *srgb,
+                                 const std::size_t count, const std::uint8_t *encode){
+          const __m256 zero{_mm256_setzero_ps()}, one{_mm256_set1_ps(1.0f)};
+          const __m256 scale{_mm256_set1_ps(srgb_steps - 1)}, half{_mm256_set1_ps(0.5f)};
+          const __m256i low_byte{_mm256_set1_epi32(0xFF)};
+          std::size_t i{0};
+
+          for(; i + 8 <= count; i += 8){
+            const __m256 clamped{_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(linear + i),
+                                                             zero), one)};
+            const __m256i index{_mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(clamped, scale),
+                                                                  half))};
+            const __m256i value{_mm256_and_si256(_mm256_i32gather_epi32(
+                                reinterpret_cast<const int*>(encode), index, 1), low_byte)};
+            const __m128i words{_mm_packus_epi32(_mm256_castsi256_si128(value),
+                                                 _mm256_extracti128_si256(value, 1))};
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(srgb + i),
+                             _mm_packus_epi16(words, words));
+          }
+          return i;
+        }
+
+        __attribute__((target("avx2")))
+        std::size_t from_srgb_avx2(const std::uint8_t *srgb, float *linear,
+                                   const std::size_t count, const float *decode){
+          std::size_t i{0};
+
+          for(; i + 8 <= count; i += 8){
+            const __m256i index{_mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                                reinterpret_cast<const __m128i*>(srgb + i)))};
+            _mm256_storeu_ps(linear + i, _mm256_i32gather_ps(decode, index, 4));
+          }
+          return i;
+        }
+
+        __attribute__((target("avx,f16c")))
+        std::size_t to_half_f16c(const float *value, std::uint16_t *half,
+                                 const std::size_t count){
+          std::size_t i{0};
+
+          for(; i + 8 <= count; i += 8)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(half + i),
+                             _mm256_cvtps_ph(_mm256_loadu_ps(value + i),
+                                             _MM_FROUND_TO_NEAREST_INT));
+          return i;
+        }
+
+        __attribute__((target("avx,f16c")))
+        std::size_t from_half_f16c(const std::uint16_t *half, float *value,
+                                   const std::size_t count){
+          std::size_t i{0};
+
+          for(; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(value + i, _mm256_cvtph_ps(_mm_loadu_si128(
+                             reinterpret_cast<const __m128i*>(half + i))));
+          return i;
+        }
+#endif
+
+        void yuv420(const std::uint8_t *bgra, const std::size_t row_bytes,
+                    const std::size_t width, const std::size_t height, std::uint8_t *y,
+                    std::uint8_t *u, std::uint8_t *v, const std::size_t step, const bool flip){
+          const std::size_t chroma_row{(width + 1) / 2 * step};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+          const simd set{instruction_set()};
+#endif
+
+          for(std::size_t row = 0; row < height; row += 2){
+            const std::size_t next{row + 1 < height ? row + 1 : row};
+            const std::uint8_t *top{bgra + (flip ? height - 1 - row : row) * row_bytes};
+            const std::uint8_t *bottom{bgra + (flip ? height - 1 - next : next) * row_bytes};
+            std::uint8_t *y_top{y + row * width}, *y_bottom{y + next * width};
+            std::uint8_t *u_row{u + row / 2 * chroma_row}, *v_row{v + row / 2 * chroma_row};
+
+            std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+            if(set == simd::avx2)
+              i = yuv420_rows_avx2(top, bottom, width, y_top, y_bottom, u_row, v_row, step);
+            else if(set == simd::sse2)
+              i = yuv420_rows_sse2(top, bottom, width, y_top, y_bottom, u_row, v_row, step);
+#endif
+            yuv420_rows_scalar(top, bottom, i, width, y_top, y_bottom, u_row, v_row, step);
+          }
+        }
+      } // namespace
+
+      void bgra_to_i420(const std::uint8_t *bgra, const std::size_t row_bytes,
+                        const std::size_t width, const std::size_t height,
+                        std::uint8_t *y, std::uint8_t *u, std::uint8_t *v, const bool flip){
+        yuv420(bgra, row_bytes, width, height, y, u, v, 1, flip);
+      }
+
+      void bgra_to_nv12(const std::uint8_t *bgra, const std::size_t row_bytes,
+                        const std::size_t width, const std::size_t height,
+                        std::uint8_t *y, std::uint8_t *uv, const bool flip){
+        yuv420(bgra, row_bytes, width, height, y, uv, uv + 1, 2, flip);
+      }
+
+      void from_half(const std::uint16_t *half, float *value, const std::size_t count){
+        std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        if(instruction_set() == simd::avx2)
+          i = from_half_f16c(half, value, count);
+#endif
+        for(; i < count; ++i)
+          value[i] = float_scalar(half[i]);
+      }
+
+      void from_srgb(const std::uint8_t *srgb, float *linear, const std::size_t count){
+        const float *decode{tables().decode};
+        std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        if(instruction_set() == simd::avx2)
+          i = from_srgb_avx2(srgb, linear, count, decode);
+#endif
+        for(; i < count; ++i)
+          linear[i] = decode[srgb[i]];
+      }
+
+      void flip_vertically(void *pixels, const std::size_t row_bytes, const std::size_t rows){
+        // memcpy already uses the widest vectors available
+        constexpr std::size_t chunk_size{4096};
+        unsigned char chunk[chunk_size];
+        unsigned char *top{static_cast<unsigned char*>(pixels)};
+        unsigned char *bottom{top + (rows > 0 ? rows - 1 : 0) * row_bytes};
+
+        for(; top < bottom; top += row_bytes, bottom -= row_bytes)
+          for(std::size_t offset = 0; offset < row_bytes; offset += chunk_size){
+            const std::size_t bytes{std::min(chunk_size, row_bytes - offset)};
+            std::memcpy(chunk, top + offset, bytes);
+            std::memcpy(top + offset, bottom + offset, bytes);
+            std::memcpy(bottom + offset, chunk, bytes);
+          }
+      }
+
+      std::size_t histogram(const std::uint32_t *values, const std::size_t count,
+                            std::uint32_t *unique, std::uint32_t *counts){
+        if(count == 0) return 0;
+
+        std::vector<std::size_t> starts{0};
+        std::size_t i{1};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        const simd set{instruction_set()};
+        if(set == simd::avx2)
+          i = run_starts_avx2(values, count, starts);
+        else if(set == simd::sse2)
+          i = run_starts_sse2(values, count, starts);
+#endif
+        run_starts_scalar(values, i, count, starts);
+        starts.push_back(count);
+
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> runs;
+        runs.reserve(starts.size() - 1);
+        for(std::size_t run = 0; run + 1 < starts.size(); ++run)
+          runs.emplace_back(values[starts[run]],
+                            static_cast<std::uint32_t>(starts[run + 1] - starts[run]));
+        std::sort(runs.begin(), runs.end());
+
+        std::size_t distinct{0};
+        for(std::size_t run = 0; run < runs.size(); ++run){
+          if(run == 0 || runs[run].first != runs[run - 1].first){
+            unique[distinct] = runs[run].first;
+            if(counts != nullptr) counts[distinct] = 0;
+            ++distinct;
+          }
+          if(counts != nullptr) counts[distinct - 1] += runs[run].second;
+        }
+        return distinct;
+      }
+
+      simd instruction_set(){
+        return static_cast<simd>(std::min(static_cast<unsigned int>(supported()),
+                                          maximum_set.load(std::memory_order_relaxed)));
+      }
+
+      void instruction_set(const simd maximum){
+        maximum_set.store(static_cast<unsigned int>(maximum), std::memory_order_relaxed);
+      }
+
+      void rgba_to_rgb(const std::uint8_t *rgba, std::uint8_t *rgb, const std::size_t pixels){
+        std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        if(instruction_set() == simd::avx2)
+          i = rgba_to_rgb_avx2(rgba, rgb, pixels);
+#endif
+        rgba_to_rgb_scalar(rgba + i * 4, rgb + i * 3, pixels - i);
+      }
+
+      void rgb_to_rgba(const std::uint8_t *rgb, std::uint8_t *rgba, const std::size_t pixels,
+                       const std::uint8_t alpha){
+        std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        if(instruction_set() == simd::avx2)
+          i = rgb_to_rgba_avx2(rgb, rgba, pixels, alpha);
+#endif
+        rgb_to_rgba_scalar(rgb + i * 3, rgba + i * 4, pixels - i, alpha);
+      }
+
+      void swap_red_blue(const std::uint8_t *source, std::uint8_t *destination,
+                         const std::size_t pixels){
+        std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        const simd set{instruction_set()};
+        if(set == simd::avx2)
+          i = swap_red_blue_avx2(source, destination, pixels);
+        else if(set == simd::sse2)
+          i = swap_red_blue_sse2(source, destination, pixels);
+#endif
+        swap_red_blue_scalar(source + i * 4, destination + i * 4, pixels - i);
+      }
+
+      void tile_hashes(const std::uint8_t *pixels, const std::size_t row_bytes,
+                       const std::size_t width, const std::size_t height,
+                       const std::size_t pixel_bytes, const std::size_t tile_size,
+                       std::uint64_t *hashes){
+        if(tile_size == 0) return;
+        const std::size_t columns{(width + tile_size - 1) / tile_size};
+        const std::size_t rows{(height + tile_size - 1) / tile_size};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        const simd set{instruction_set()};
+#endif
+
+        for(std::size_t row = 0; row < rows; ++row){
+          const std::size_t first{row * tile_size};
+          const std::size_t last{std::min(height, first + tile_size)};
+          for(std::size_t column = 0; column < columns; ++column){
+            const std::size_t x{column * tile_size};
+            const std::size_t size{(std::min(width, x + tile_size) - x) * pixel_bytes};
+            hash_state state;
+            for(std::size_t lane = 0; lane < 4; ++lane){
+              state.lanes[lane] = hash_keys[lane ^ 2];
+              state.keys[lane] = hash_keys[lane];
+            }
+
+            for(std::size_t line = first; line < last; ++line){
+              const std::uint8_t *bytes{pixels + line * row_bytes + x * pixel_bytes};
+              std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+              if(set == simd::avx2)
+                i = hash_stripes_avx2(bytes, size, state);
+              else if(set == simd::sse2)
+                i = hash_stripes_sse2(bytes, size, state);
+#endif
+              for(; i + 32 <= size; i += 32)
+                hash_stripe_scalar(bytes + i, state);
+              if(i < size){
+                // the end of the row is padded with zeros, the size is mixed in below
+                std::uint8_t stripe[32]{};
+                std::memcpy(stripe, bytes + i, size - i);
+                hash_stripe_scalar(stripe, state);
+              }
+            }
+
+            std::uint64_t hash{mix_scalar(static_cast<std::uint64_t>(size) << 32 | (last - first))};
+            for(std::size_t lane = 0; lane < 4; ++lane)
+              hash = mix_scalar(hash ^ state.lanes[lane]);
+            hashes[row * columns + column] = hash;
+          }
+        }
+      }
+
+      void to_half(const float *value, std::uint16_t *half, const std::size_t count){
+        std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        if(instruction_set() == simd::avx2)
+          i = to_half_f16c(value, half, count);
+#endif
+        for(; i < count; ++i)
+          half[i] = half_scalar(value[i]);
+      }
+
+      void to_srgb(const float *linear, std::uint8_t *srgb, const std::size_t count){
+        const std::uint8_t *encode{tables().encode};
+        std::size_t i{0};
+#ifdef RAMROD_GL_PIXEL_CONVERSION_X86
+        const simd set{instruction_set()};
+        if(set == simd::avx2)
+          i = to_srgb_avx2(linear, srgb, count, encode);
+        else if(set == simd::sse2)
+          i = to_srgb_sse2(linear, srgb, count, encode);
+#endif
+        for(; i < count; ++i)
+          srgb[i] = srgb_scalar(linear[i], encode);
+      }
+    } // namespace: pixel
+  } // namespace: gl
+} // namespace: ramrod
@@ -0,0 +1,242 @@
+#include "ramrod/gl/readback_pool.h"
+
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "ramrod/gl/frame_buffer.h"
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      constexpr std::size_t page_bytes{4096};
+      constexpr std::size_t huge_page_bytes{2 << 20};
+
+      std::size_t round_up(const std::size_t bytes, const std::size_t alignment){
+        return (bytes + alignment - 1) / alignment * alignment;
+      }
+
+      // Page aligned memory, freed with aligned_free()
+      void *aligned_allocate(const std::size_t bytes){
+#ifdef _WIN32
+        return _aligned_malloc(round_up(bytes, page_bytes), page_bytes);
+#else
+        return std::aligned_alloc(page_bytes, round_up(bytes, page_bytes));
+#endif
+      }
+
+      void aligned_free(void *data){
+#ifdef _WIN32
+        _aligned_free(data);
+#else
+        std::free(data);
+#endif
+      }
+    }
+
+    readback_pool::readback_pool(const delivery_callback &deliver, const std::size_t in_flight) :
+      deliver_(deliver),
+      readbacks_(in_flight == 0 ? 1 : in_flight),
+      entries_(),
+      in_flight_(),
+      max_in_flight_(in_flight == 0 ? 1 : in_flight),
+      mutex_(),
+      statistics_()
+    {
+      in_flight_.reserve(max_in_flight_);
+    }
+
+    readback_pool::~readback_pool(){
+      for(entry &item : entries_){
+        if(!item.owned) continue;
+#ifndef _WIN32
+        if(item.mapped > 0)
+          munmap(item.buffer.data, item.mapped);
+        else
+#endif
+          aligned_free(item.buffer.data);
+      }
+    }
+
+    bool readback_pool::add(void *data, const std::size_t capacity){
+      if(data == nullptr || capacity == 0) return false;
+      return register_buffer(static_cast<std::uint8_t*>(data), capacity, 0, false);
+    }
+
+    bool readback_pool::allocate(const std::size_t count, const std::size_t bytes,
+                                 const bool huge_pages){
+      if(count == 0 || bytes == 0) return false;
+
+      for(std::size_t i = 0; i < count; ++i){
+        void *data{nullptr};
+        std::size_t mapped{0};
+#ifdef _WIN32
+        // huge pages need the SeLockMemoryPrivilege, the buffers use regular pages
+        static_cast<void>(huge_pages);
+#else
+        if(huge_pages){
+          mapped = round_up(bytes, huge_page_bytes);
+#ifdef MAP_HUGETLB
+          // only succeeds when the administrator reserved huge pages
+          data = mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+          if(data != MAP_FAILED){
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++statistics_.huge_pages;
+          }
+#else
+          data = MAP_FAILED;
+#endif
+          if(data == MAP_FAILED){
+            data = mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+            if(data != MAP_FAILED) madvise(data, mapped, MADV_HUGEPAGE);
+#endif
+          }
+          if(data == MAP_FAILED) return false;
+        }
+#endif
+        if(mapped == 0){
+          data = aligned_allocate(bytes);
+          if(data == nullptr) return false;
+        }
+        register_buffer(static_cast<std::uint8_t*>(data), bytes, mapped, true);
+      }
+      return true;
+    }
+
+    std::size_t readback_pool::available() const{
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::size_t count{0};
+      for(const entry &item : entries_)
+        if(item.free) ++count;
+      return count;
+    }
+
+    std::size_t readback_pool::pending() const{
+      return in_flight_.size();
+    }
+
+    std::uint64_t readback_pool::read(const GLint x, const GLint y,
+                                      const GLsizei width, const GLsizei height,
+                                      const GLenum format, const GLenum type){
+      return queue(width, height, format, type, nullptr, GL_NONE, x, y);
+    }
+
+    std::uint64_t readback_pool::read(frame_buffer &source, const GLenum attachment,
+                                      const GLint x, const GLint y,
+                                      const GLsizei width, const GLsizei height,
+                                      const GLenum format, const GLenum type){
+      if(!source.is_created()) return 0;
+      return queue(width, height, format, type, &source, attachment, x, y);
+    }
+
+    bool readback_pool::recycle(const pooled_buffer &buffer){
+      std::lock_guard<std::mutex> lock(mutex_);
+      if(buffer.index >= entries_.size()) return false;
+
+      entry &item{entries_[buffer.index]};
+      if(item.buffer.data != buffer.data || item.free) return false;
+      item.free = true;
+      ++statistics_.recycled;
+      return true;
+    }
+
+    readback_pool_statistics readback_pool::statistics() const{
+      std::lock_guard<std::mutex> lock(mutex_);
+      return statistics_;
+    }
+
+    void readback_pool::update(const bool wait){
+      while(!in_flight_.empty()){
+        const std::size_t index{in_flight_.front()};
+        const std::uint64_t ticket{entries_[index].buffer.ticket};
+        if(!wait && !readbacks_.is_ready(ticket)) break;
+
+        const bool fetched{readbacks_.fetch(ticket, entries_[index].buffer.data, true)};
+        in_flight_.erase(in_flight_.begin());
+        if(!fetched){
+          // the pixel buffer could not be mapped, the read is lost
+          readbacks_.cancel(ticket);
+          std::lock_guard<std::mutex> lock(mutex_);
+          entries_[index].free = true;
+          continue;
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          ++statistics_.delivered;
+        }
+        // a copy, the callback may register buffers or read again
+        const pooled_buffer delivered{entries_[index].buffer};
+        deliver_(delivered);
+      }
+    }
+
+    std::uint64_t readback_pool::queue(const GLsizei width, const GLsizei height,
+                                       const GLenum format, const GLenum type,
+                                       frame_buffer *source, const GLenum attachment,
+                                       const GLint x, const GLint y){
+      std::size_t row_bytes{0};
+      const std::size_t size{readback_queue::required_size(width, height, format, type,
+                                                           &row_bytes)};
+      if(size == 0 || in_flight_.size() >= max_in_flight_) return 0;
+
+      entry *item{nullptr};
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++statistics_.requested;
+        for(entry &candidate : entries_){
+          if(candidate.free && candidate.buffer.capacity >= size){
+            item = &candidate;
+            break;
+          }
+        }
+        if(item == nullptr){
+          ++statistics_.starved;
+          return 0;
+        }
+        item->free = false;
+      }
+
+      const std::uint64_t ticket{source == nullptr
+                                 ? readbacks_.read(x, y, width, height, format, type)
+                                 : readbacks_.read(*source, attachment, x, y, width, height,
+                                                   format, type)};
+      if(ticket == 0){
+        std::lock_guard<std::mutex> lock(mutex_);
+        item->free = true;
+        return 0;
+      }
+
+      item->buffer.size = size;
+      item->buffer.row_bytes = row_bytes;
+      item->buffer.width = width;
+      item->buffer.height = height;
+      item->buffer.format = format;
+      item->buffer.type = type;
+      item->buffer.ticket = ticket;
+      in_flight_.push_back(item->buffer.index);
+      return ticket;
+    }
+
+    bool readback_pool::register_buffer(std::uint8_t *data, const std::size_t capacity,
+                                        const std::size_t mapped, const bool owned){
+      std::lock_guard<std::mutex> lock(mutex_);
+      entry item;
+      item.buffer.data = data;
+      item.buffer.capacity = capacity;
+      item.buffer.index = entries_.size();
+      item.mapped = mapped;
+      item.owned = owned;
+      item.free = true;
+      entries_.push_back(item);
+      return true;
+    }
+  } // namespace: gl
+} // namespace: ramrod
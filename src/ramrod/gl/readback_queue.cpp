@@ -0,0 +1,260 @@
+#include "ramrod/gl/readback_queue.h"
+
+#include <cstring>
+
+#include "ramrod/gl/frame_buffer.h"
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      std::size_t pixel_bytes(const GLenum format, const GLenum type){
+        switch(type){
+          case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+          case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_24_8:
+          case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+          return 4;
+          case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+          return 8;
+          default:
+          break;
+        }
+
+        std::size_t components{0};
+        switch(format){
+          case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER:
+          case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+          components = 1;
+          break;
+          case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+          components = 2;
+          break;
+          case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+          components = 3;
+          break;
+          case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+          components = 4;
+          break;
+          default:
+          return 0;
+        }
+
+        switch(type){
+          case GL_UNSIGNED_BYTE: case GL_BYTE:
+          return components;
+          case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+          return components * 2;
+          case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+          return components * 4;
+          default:
+          return 0;
+        }
+      }
+    }
+
+    readback_queue::readback_queue(const std::size_t slots) :
+      slots_(slots == 0 ? 1 : slots),
+      next_ticket_(1),
+      statistics_()
+    {
+      for(slot &item : slots_){
+        item.ticket = 0;
+        item.capacity = 0;
+        item.size = 0;
+        item.mapped = false;
+      }
+    }
+
+    readback_queue::~readback_queue(){
+      for(slot &item : slots_){
+        if(item.mapped){
+          item.buffer.bind();
+          item.buffer.unmap();
+          item.buffer.release();
+        }
+      }
+    }
+
+    bool readback_queue::cancel(const std::uint64_t ticket){
+      slot *item{find(ticket)};
+      if(item == nullptr) return false;
+
+      if(item->mapped) return release(ticket);
+      free(*item);
+      return true;
+    }
+
+    bool readback_queue::fetch(const std::uint64_t ticket, void *destination, const bool wait){
+      slot *item{find(ticket)};
+      if(item == nullptr || destination == nullptr || item->mapped) return false;
+
+      const std::size_t size{item->size};
+      const void *pixels{map(ticket, wait)};
+      if(pixels == nullptr) return false;
+
+      std::memcpy(destination, pixels, size);
+      return release(ticket);
+    }
+
+    bool readback_queue::is_ready(const std::uint64_t ticket){
+      slot *item{find(ticket)};
+      return item != nullptr && signaled(*item, false);
+    }
+
+    const void *readback_queue::map(const std::uint64_t ticket, const bool wait){
+      slot *item{find(ticket)};
+      if(item == nullptr || item->mapped || !signaled(*item, wait)) return nullptr;
+
+      GLint previous_pack{0};
+      glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previous_pack);
+
+      item->buffer.bind();
+      const void *pixels{item->buffer.map_range(0, static_cast<GLsizeiptr>(item->size),
+                                                GL_MAP_READ_BIT)};
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, static_cast<GLuint>(previous_pack));
+
+      item->mapped = pixels != nullptr;
+      return pixels;
+    }
+
+    std::size_t readback_queue::pending() const{
+      std::size_t count{0};
+      for(const slot &item : slots_)
+        if(item.ticket != 0) ++count;
+      return count;
+    }
+
+    std::uint64_t readback_queue::read(const GLint x, const GLint y,
+                                       const GLsizei width, const GLsizei height,
+                                       const GLenum format, const GLenum type){
+      const std::size_t size{required_size(width, height, format, type)};
+      if(size == 0) return 0;
+
+      ++statistics_.requested;
+      slot *item{nullptr};
+      for(slot &candidate : slots_){
+        if(candidate.ticket == 0){
+          item = &candidate;
+          break;
+        }
+      }
+      if(item == nullptr){
+        ++statistics_.dropped;
+        return 0;
+      }
+
+      GLint previous_pack{0};
+      glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previous_pack);
+
+      if(!item->buffer.is_created() && !item->buffer.generate()){
+        ++statistics_.dropped;
+        return 0;
+      }
+      item->buffer.bind();
+      if(item->capacity < size){
+        item->buffer.allocate_data(nullptr, static_cast<GLsizei>(size), GL_STREAM_READ);
+        item->capacity = size;
+      }
+      item->buffer.read_pixels(x, y, width, height, format, type, nullptr);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, static_cast<GLuint>(previous_pack));
+
+      item->fence.insert();
+      item->size = size;
+      item->ticket = next_ticket_++;
+      return item->ticket;
+    }
+
+    std::uint64_t readback_queue::read(frame_buffer &source, const GLenum attachment,
+                                       const GLint x, const GLint y,
+                                       const GLsizei width, const GLsizei height,
+                                       const GLenum format, const GLenum type){
+      if(!source.is_created()) return 0;
+
+      GLint previous_frame{0}, previous_read_buffer{GL_NONE};
+      glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous_frame);
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, source.frame_id());
+      glGetIntegerv(GL_READ_BUFFER, &previous_read_buffer);
+      glReadBuffer(attachment);
+
+      const std::uint64_t ticket{read(x, y, width, height, format, type)};
+
+      glReadBuffer(static_cast<GLenum>(previous_read_buffer));
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previous_frame));
+      return ticket;
+    }
+
+    bool readback_queue::release(const std::uint64_t ticket){
+      slot *item{find(ticket)};
+      if(item == nullptr || !item->mapped) return false;
+
+      GLint previous_pack{0};
+      glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previous_pack);
+      item->buffer.bind();
+      item->buffer.unmap();
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, static_cast<GLuint>(previous_pack));
+
+      item->mapped = false;
+      ++statistics_.completed;
+      statistics_.total_bytes += item->size;
+      free(*item);
+      return true;
+    }
+
+    std::size_t readback_queue::required_size(const GLsizei width, const GLsizei height,
+                                              const GLenum format, const GLenum type,
+                                              std::size_t *row_bytes){
+      const std::size_t bytes{pixel_bytes(format, type)};
+      if(width <= 0 || height <= 0 || bytes == 0) return 0;
+
+      GLint alignment{4};
+      glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+      const std::size_t align{static_cast<std::size_t>(alignment > 0 ? alignment : 1)};
+      const std::size_t row{(static_cast<std::size_t>(width) * bytes + align - 1)
+                            / align * align};
+      if(row_bytes != nullptr) *row_bytes = row;
+      // the last row is not padded
+      return row * static_cast<std::size_t>(height - 1) + static_cast<std::size_t>(width) * bytes;
+    }
+
+    std::size_t readback_queue::size(const std::uint64_t ticket) const{
+      const slot *item{find(ticket)};
+      return item == nullptr ? 0 : item->size;
+    }
+
+    const readback_statistics &readback_queue::statistics() const{
+      return statistics_;
+    }
+
+    readback_queue::slot *readback_queue::find(const std::uint64_t ticket){
+      if(ticket == 0) return nullptr;
+      for(slot &item : slots_)
+        if(item.ticket == ticket) return &item;
+      return nullptr;
+    }
+
+    const readback_queue::slot *readback_queue::find(const std::uint64_t ticket) const{
+      if(ticket == 0) return nullptr;
+      for(const slot &item : slots_)
+        if(item.ticket == ticket) return &item;
+      return nullptr;
+    }
+
+    void readback_queue::free(slot &item){
+      item.fence.delete_sync();
+      item.ticket = 0;
+      item.size = 0;
+    }
+
+    bool readback_queue::signaled(slot &item, const bool wait){
+      const fence::status status{item.fence.wait(0)};
+      if(status == fence::status::timeout && wait){
+        ++statistics_.stalls;
+        if(!item.fence.finish()) return false;
+      }else if(status == fence::status::timeout || status == fence::status::failed){
+        return false;
+      }
+
+      item.fence.delete_sync();
+      return true;
+    }
+  } // namespace: gl
+} // namespace: ramrod
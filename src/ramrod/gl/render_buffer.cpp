@@ -3,7 +3,8 @@
 namespace ramrod {
   namespace gl {
     render_buffer::render_buffer(const bool create) :
-      id_(0)
+      id_(0),
+      samples_(0)
     {
       if(create)
         generate();
@@ -26,6 +27,7 @@ namespace ramrod {
       if(id_ == 0) return false;
       glDeleteRenderbuffers(1, &id_);
       id_ = 0;
+      samples_ = 0;
       return true;
     }
 
@@ -50,9 +52,22 @@ namespace ramrod {
       glBindRenderbuffer(GL_RENDERBUFFER, 0);
     }
 
+    GLsizei render_buffer::samples(){
+      return samples_;
+    }
+
     bool render_buffer::storage(const GLsizei width, const GLsizei height, const GLenum format){
       if(id_ == 0) return false;
       glRenderbufferStorage(GL_RENDERBUFFER, format, width, height);
+      samples_ = 0;
+      return true;
+    }
+
+    bool render_buffer::storage_multisample(const GLsizei samples, const GLsizei width,
+                                            const GLsizei height, const GLenum format){
+      if(id_ == 0) return false;
+      glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, format, width, height);
+      glGetRenderbufferParameteriv(GL_RENDERBUFFER, GL_RENDERBUFFER_SAMPLES, &samples_);
       return true;
     }
   }
@@ -0,0 +1,276 @@
+#include "ramrod/gl/render_target_pool.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      // Bits per sample of the bound render buffer, as reported by the driver
+      std::size_t render_buffer_bits(){
+        static constexpr GLenum sizes[]{
+          GL_RENDERBUFFER_RED_SIZE, GL_RENDERBUFFER_GREEN_SIZE, GL_RENDERBUFFER_BLUE_SIZE,
+          GL_RENDERBUFFER_ALPHA_SIZE, GL_RENDERBUFFER_DEPTH_SIZE, GL_RENDERBUFFER_STENCIL_SIZE
+        };
+        std::size_t bits{0};
+        for(const GLenum size : sizes){
+          GLint value{0};
+          glGetRenderbufferParameteriv(GL_RENDERBUFFER, size, &value);
+          bits += static_cast<std::size_t>(std::max(0, value));
+        }
+        return bits;
+      }
+    }
+
+    bool render_target_description::operator==(const render_target_description &other) const{
+      return width == other.width && height == other.height
+          && internal_format == other.internal_format && samples == other.samples
+          && sampled == other.sampled;
+    }
+
+    bool render_target_description::operator!=(const render_target_description &other) const{
+      return !(*this == other);
+    }
+
+    std::size_t render_target_description_hash::operator()(
+        const render_target_description &description) const{
+      std::size_t seed{std::hash<GLsizei>()(description.width)};
+      const auto combine = [&seed](const std::size_t value){
+        seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+      };
+      combine(std::hash<GLsizei>()(description.height));
+      combine(std::hash<GLenum>()(description.internal_format));
+      combine(std::hash<GLsizei>()(description.samples));
+      combine(std::hash<bool>()(description.sampled));
+      return seed;
+    }
+
+    render_target::render_target(const render_target_description &description) :
+      description_(description),
+      image_(false, 0, false),
+      multisample_image_(false, 0, false),
+      storage_(false),
+      bytes_(0),
+      last_used_(0),
+      in_use_(false)
+    {
+      if(!description.sampled){
+        if(!storage_.generate()) return;
+        storage_.bind();
+        if(description.samples > 0)
+          storage_.storage_multisample(description.samples, description.width,
+                                       description.height, description.internal_format);
+        else
+          storage_.storage(description.width, description.height, description.internal_format);
+        // the driver may round the samples up
+        bytes_ = static_cast<std::size_t>(description.width) * description.height
+                 * static_cast<std::size_t>(std::max<GLsizei>(1, storage_.samples()))
+                 * render_buffer_bits() / 8;
+        storage_.release();
+      }else if(description.samples > 0){
+        if(!multisample_image_.generate()) return;
+        multisample_image_.bind();
+        multisample_image_.storage_multisample(description.samples, description.internal_format,
+                                               description.width, description.height);
+        bytes_ = multisample_image_.memory_size();
+      }else{
+        if(!image_.generate()) return;
+        image_.bind();
+        image_.storage(1, description.internal_format, description.width, description.height);
+        image_.parameter(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_LINEAR, GL_LINEAR);
+        bytes_ = image_.memory_size();
+      }
+    }
+
+    render_target::~render_target(){}
+
+    GLenum render_target::attachment() const{
+      return attachment(description_.internal_format);
+    }
+
+    GLenum render_target::attachment(const GLenum internal_format){
+      switch(internal_format){
+        case GL_DEPTH24_STENCIL8: case GL_DEPTH32F_STENCIL8: case GL_DEPTH_STENCIL:
+        return GL_DEPTH_STENCIL_ATTACHMENT;
+        case GL_DEPTH_COMPONENT16: case GL_DEPTH_COMPONENT24: case GL_DEPTH_COMPONENT32:
+        case GL_DEPTH_COMPONENT32F: case GL_DEPTH_COMPONENT:
+        return GL_DEPTH_ATTACHMENT;
+        case GL_STENCIL_INDEX8:
+        return GL_STENCIL_ATTACHMENT;
+        default:
+        return GL_COLOR_ATTACHMENT0;
+      }
+    }
+
+    const render_target_description &render_target::description() const{
+      return description_;
+    }
+
+    GLuint render_target::id(){
+      if(!description_.sampled) return storage_.id();
+      return description_.samples > 0 ? multisample_image_.id() : image_.id();
+    }
+
+    texture *render_target::image(){
+      if(!description_.sampled) return nullptr;
+      if(description_.samples > 0) return &multisample_image_;
+      return &image_;
+    }
+
+    std::size_t render_target::memory_size() const{
+      return bytes_;
+    }
+
+    GLenum render_target::target() const{
+      if(!description_.sampled) return GL_RENDERBUFFER;
+      return description_.samples > 0 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+    }
+
+    render_target_pool::render_target_pool(const unsigned int frames_to_keep) :
+      targets_(),
+      free_(),
+      frame_buffers_(),
+      frame_(0),
+      frames_to_keep_(frames_to_keep),
+      statistics_()
+    {}
+
+    render_target_pool::~render_target_pool(){
+      clear();
+    }
+
+    render_target *render_target_pool::acquire(const render_target_description &description){
+      if(description.width <= 0 || description.height <= 0 || description.samples < 0)
+        return nullptr;
+
+      std::vector<render_target*> &available{free_[description]};
+      if(!available.empty()){
+        render_target *target{available.back()};
+        available.pop_back();
+        target->in_use_ = true;
+        target->last_used_ = frame_;
+        ++statistics_.reused;
+        return target;
+      }
+
+      std::unique_ptr<render_target> created{new render_target(description)};
+      if(created->id() == 0) return nullptr;
+
+      created->in_use_ = true;
+      created->last_used_ = frame_;
+      ++statistics_.created;
+      ++statistics_.targets;
+      statistics_.bytes += created->bytes_;
+      statistics_.peak_bytes = std::max(statistics_.peak_bytes, statistics_.bytes);
+      targets_.push_back(std::move(created));
+      return targets_.back().get();
+    }
+
+    frame_buffer *render_target_pool::acquire_frame_buffer(const std::vector<render_target*> &colors,
+                                                           render_target *depth){
+      std::vector<const render_target*> key(colors.begin(), colors.end());
+      key.push_back(depth);
+
+      std::unique_ptr<frame_buffer> &cached{frame_buffers_[key]};
+      if(cached){
+        cached->bind();
+        return cached.get();
+      }
+
+      std::unique_ptr<frame_buffer> created{new frame_buffer(true)};
+      created->bind();
+
+      std::vector<GLenum> buffers;
+      buffers.reserve(colors.size());
+      for(std::size_t i = 0; i < colors.size(); ++i){
+        render_target *color{colors[i]};
+        const GLenum attachment{GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i)};
+        if(color->target() == GL_RENDERBUFFER)
+          color->storage_.attach_render_to_framebuffer(attachment);
+        else
+          created->attach_2D(color->id(), attachment, color->target());
+        buffers.push_back(attachment);
+      }
+      if(depth != nullptr){
+        if(depth->target() == GL_RENDERBUFFER)
+          depth->storage_.attach_render_to_framebuffer(depth->attachment());
+        else
+          created->attach_2D(depth->id(), depth->attachment(), depth->target());
+      }
+
+      if(buffers.empty())
+        created->draw_buffer(GL_NONE);
+      else
+        created->draw_buffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+
+      if(created->status() != GL_FRAMEBUFFER_COMPLETE){
+        created->release();
+        frame_buffers_.erase(key);
+        return nullptr;
+      }
+
+      cached = std::move(created);
+      ++statistics_.frame_buffers;
+      return cached.get();
+    }
+
+    void render_target_pool::clear(){
+      frame_buffers_.clear();
+      free_.clear();
+      statistics_.destroyed += targets_.size();
+      targets_.clear();
+      statistics_.targets = 0;
+      statistics_.frame_buffers = 0;
+      statistics_.bytes = 0;
+    }
+
+    void render_target_pool::end_frame(){
+      std::vector<render_target*> expired;
+
+      for(std::unique_ptr<render_target> &target : targets_){
+        if(target->in_use_) release(target.get());
+        if(frame_ - target->last_used_ >= frames_to_keep_)
+          expired.push_back(target.get());
+      }
+      for(render_target *target : expired)
+        destroy(target);
+
+      ++frame_;
+    }
+
+    bool render_target_pool::release(render_target *target){
+      if(target == nullptr || !target->in_use_) return false;
+
+      target->in_use_ = false;
+      free_[target->description_].push_back(target);
+      return true;
+    }
+
+    const render_pool_statistics &render_target_pool::statistics() const{
+      return statistics_;
+    }
+
+    void render_target_pool::destroy(render_target *target){
+      for(auto it = frame_buffers_.begin(); it != frame_buffers_.end();){
+        if(std::find(it->first.begin(), it->first.end(), target) != it->first.end()){
+          it = frame_buffers_.erase(it);
+          --statistics_.frame_buffers;
+        }else{
+          ++it;
+        }
+      }
+
+      std::vector<render_target*> &available{free_[target->description_]};
+      available.erase(std::remove(available.begin(), available.end(), target), available.end());
+      if(available.empty()) free_.erase(target->description_);
+
+      statistics_.bytes -= target->bytes_;
+      --statistics_.targets;
+      ++statistics_.destroyed;
+      targets_.erase(std::find_if(targets_.begin(), targets_.end(),
+                                  [target](const std::unique_ptr<render_target> &owned){
+                                    return owned.get() == target;
+                                  }));
+    }
+  } // namespace: gl
+} // namespace: ramrod
@@ -0,0 +1,125 @@
+#include "ramrod/gl/sampler.h"
+
+#include <functional>
+
+#include "ramrod/gl/texture_units.h"
+
+namespace ramrod {
+  namespace gl {
+    bool sampler_state::operator==(const sampler_state &other) const {
+      return wrap_s == other.wrap_s && wrap_t == other.wrap_t && wrap_r == other.wrap_r
+          && min_filter == other.min_filter && mag_filter == other.mag_filter
+          && compare_mode == other.compare_mode && compare_function == other.compare_function
+          && min_lod == other.min_lod && max_lod == other.max_lod && lod_bias == other.lod_bias
+          && max_anisotropy == other.max_anisotropy
+          && border_color[0] == other.border_color[0] && border_color[1] == other.border_color[1]
+          && border_color[2] == other.border_color[2] && border_color[3] == other.border_color[3];
+    }
+
+    bool sampler_state::operator!=(const sampler_state &other) const {
+      return !(*this == other);
+    }
+
+    std::size_t sampler_state_hash::operator()(const sampler_state &state) const {
+      std::size_t seed{0};
+      const auto combine = [&seed](const std::size_t value){
+        seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+      };
+
+      combine(std::hash<GLint>()(state.wrap_s));
+      combine(std::hash<GLint>()(state.wrap_t));
+      combine(std::hash<GLint>()(state.wrap_r));
+      combine(std::hash<GLint>()(state.min_filter));
+      combine(std::hash<GLint>()(state.mag_filter));
+      combine(std::hash<GLint>()(state.compare_mode));
+      combine(std::hash<GLint>()(state.compare_function));
+      combine(std::hash<GLfloat>()(state.min_lod));
+      combine(std::hash<GLfloat>()(state.max_lod));
+      combine(std::hash<GLfloat>()(state.lod_bias));
+      combine(std::hash<GLfloat>()(state.max_anisotropy));
+      for(const GLfloat channel : state.border_color)
+        combine(std::hash<GLfloat>()(channel));
+      return seed;
+    }
+
+    sampler::sampler(const bool create) :
+      id_(0),
+      state_()
+    {
+      if(create)
+        generate();
+    }
+
+    sampler::~sampler(){
+      if(id_ > 0){
+        texture_units::current().forget_sampler(id_);
+        glDeleteSamplers(1, &id_);
+      }
+    }
+
+    bool sampler::bind(const GLuint unit) const {
+      if(id_ == 0) return false;
+      texture_units::current().bind_sampler(unit, id_);
+      return true;
+    }
+
+    bool sampler::delete_sampler(){
+      if(id_ == 0) return false;
+      texture_units::current().forget_sampler(id_);
+      glDeleteSamplers(1, &id_);
+      id_ = 0;
+      return true;
+    }
+
+    bool sampler::generate(){
+      if(id_ > 0) return false;
+      glGenSamplers(1, &id_);
+      return id_ > 0;
+    }
+
+    GLuint sampler::id() const {
+      return id_;
+    }
+
+    bool sampler::parameter(const sampler_state &new_state){
+      if(id_ == 0) return false;
+
+      glSamplerParameteri(id_, GL_TEXTURE_WRAP_S, new_state.wrap_s);
+      glSamplerParameteri(id_, GL_TEXTURE_WRAP_T, new_state.wrap_t);
+      glSamplerParameteri(id_, GL_TEXTURE_WRAP_R, new_state.wrap_r);
+      glSamplerParameteri(id_, GL_TEXTURE_MIN_FILTER, new_state.min_filter);
+      glSamplerParameteri(id_, GL_TEXTURE_MAG_FILTER, new_state.mag_filter);
+      glSamplerParameteri(id_, GL_TEXTURE_COMPARE_MODE, new_state.compare_mode);
+      glSamplerParameteri(id_, GL_TEXTURE_COMPARE_FUNC, new_state.compare_function);
+      glSamplerParameterf(id_, GL_TEXTURE_MIN_LOD, new_state.min_lod);
+      glSamplerParameterf(id_, GL_TEXTURE_MAX_LOD, new_state.max_lod);
+      glSamplerParameterf(id_, GL_TEXTURE_LOD_BIAS, new_state.lod_bias);
+      glSamplerParameterfv(id_, GL_TEXTURE_BORDER_COLOR, new_state.border_color);
+      if(GLAD_GL_EXT_texture_filter_anisotropic)
+        glSamplerParameterf(id_, GL_TEXTURE_MAX_ANISOTROPY_EXT, new_state.max_anisotropy);
+
+      state_ = new_state;
+      return true;
+    }
+
+    bool sampler::parameter(const GLenum parameter_name, const GLint value){
+      if(id_ == 0) return false;
+      glSamplerParameteri(id_, parameter_name, value);
+      return true;
+    }
+
+    bool sampler::parameter(const GLenum parameter_name, const GLfloat value){
+      if(id_ == 0) return false;
+      glSamplerParameterf(id_, parameter_name, value);
+      return true;
+    }
+
+    void sampler::release(const GLuint unit){
+      texture_units::current().bind_sampler(unit, 0);
+    }
+
+    const sampler_state &sampler::state() const {
+      return state_;
+    }
+  } // namespace: gl
+} // namespace: ramrod
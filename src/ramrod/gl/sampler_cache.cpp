@@ -0,0 +1,36 @@
+#include "ramrod/gl/sampler_cache.h"
+
+namespace ramrod {
+  namespace gl {
+    sampler_cache::sampler_cache() :
+      samplers_()
+    {}
+
+    sampler_cache::~sampler_cache(){}
+
+    const sampler *sampler_cache::acquire(const sampler_state &state){
+      const auto found{samplers_.find(state)};
+      if(found != samplers_.end()) return found->second.get();
+
+      std::unique_ptr<sampler> shared{std::make_unique<sampler>(true)};
+      if(shared->id() == 0) return nullptr;
+      shared->parameter(state);
+
+      return samplers_.emplace(state, std::move(shared)).first->second.get();
+    }
+
+    bool sampler_cache::bind(const GLuint unit, const sampler_state &state){
+      const sampler *shared{acquire(state)};
+      if(shared == nullptr) return false;
+      return shared->bind(unit);
+    }
+
+    void sampler_cache::clear(){
+      samplers_.clear();
+    }
+
+    std::size_t sampler_cache::size() const {
+      return samplers_.size();
+    }
+  } // namespace: gl
+} // namespace: ramrod
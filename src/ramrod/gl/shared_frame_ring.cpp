@@ -0,0 +1,332 @@
+#include "ramrod/gl/shared_frame_ring.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ramrod/gl/frame_buffer.h"
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      // "RRGL" in memory
+      constexpr std::uint32_t ring_magic{0x4C475252u};
+      constexpr std::uint32_t ring_version{1};
+      // size of the ring header and alignment of the slots
+      constexpr std::size_t ring_page{4096};
+      constexpr std::size_t slot_header_bytes{64};
+
+      static_assert(sizeof(shared_ring_header) <= ring_page, "the ring header is too big");
+      static_assert(sizeof(shared_slot_header) == slot_header_bytes,
+                    "the slot header is not 64 bytes");
+
+      std::size_t slot_offset(const std::uint64_t sequence, const std::size_t slots,
+                              const std::size_t stride){
+        return ring_page + static_cast<std::size_t>((sequence - 1) % slots) * stride;
+      }
+    }
+
+    shared_frame_ring::shared_frame_ring(const std::size_t slots, const std::size_t in_flight) :
+      readbacks_(in_flight == 0 ? 1 : in_flight),
+      pending_(),
+      name_(),
+      memory_(nullptr),
+      memory_size_(0),
+      slots_(slots < 2 ? 2 : slots),
+      in_flight_(in_flight == 0 ? 1 : in_flight),
+      sequence_(0),
+      width_(0),
+      height_(0),
+      format_(GL_RGBA),
+      type_(GL_UNSIGNED_BYTE),
+      statistics_()
+    {}
+
+    shared_frame_ring::~shared_frame_ring(){
+      destroy();
+    }
+
+    bool shared_frame_ring::capture(){
+      if(!is_created()) return false;
+
+      update();
+      if(pending_.size() >= in_flight_){
+        ++statistics_.stalls;
+        publish(true);
+      }
+      return submit(readbacks_.read(0, 0, width_, height_, format_, type_));
+    }
+
+    bool shared_frame_ring::capture(frame_buffer &source, const GLenum attachment){
+      if(!is_created() || !source.is_created()) return false;
+
+      update();
+      if(pending_.size() >= in_flight_){
+        ++statistics_.stalls;
+        publish(true);
+      }
+      return submit(readbacks_.read(source, attachment, 0, 0, width_, height_, format_, type_));
+    }
+
+    bool shared_frame_ring::create(const std::string &name, const GLsizei width,
+                                   const GLsizei height, const GLenum format, const GLenum type){
+#ifdef _WIN32
+      static_cast<void>(name);
+      static_cast<void>(width);
+      static_cast<void>(height);
+      static_cast<void>(format);
+      static_cast<void>(type);
+      return false;
+#else
+      if(is_created() || name.empty()) return false;
+
+      std::size_t row_bytes{0};
+      const std::size_t frame_bytes{readback_queue::required_size(width, height, format, type,
+                                                                  &row_bytes)};
+      if(frame_bytes == 0) return false;
+
+      const std::size_t stride{(slot_header_bytes + frame_bytes + ring_page - 1)
+                               / ring_page * ring_page};
+      const std::size_t size{ring_page + slots_ * stride};
+
+      // readers of a previous object keep their mapping instead of seeing it truncated
+      shm_unlink(name.c_str());
+      const int descriptor{shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600)};
+      if(descriptor < 0) return false;
+      if(ftruncate(descriptor, static_cast<off_t>(size)) != 0){
+        ::close(descriptor);
+        shm_unlink(name.c_str());
+        return false;
+      }
+      void *memory{mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0)};
+      ::close(descriptor);
+      if(memory == MAP_FAILED){
+        shm_unlink(name.c_str());
+        return false;
+      }
+
+      memory_ = static_cast<std::uint8_t*>(memory);
+      memory_size_ = size;
+      name_ = name;
+      width_ = width;
+      height_ = height;
+      format_ = format;
+      type_ = type;
+      sequence_ = 0;
+
+      for(std::size_t i = 0; i < slots_; ++i)
+        new(memory_ + ring_page + i * stride) shared_slot_header{{0}, 0, 0};
+
+      shared_ring_header *header{new(memory_) shared_ring_header{{0}, ring_version,
+                                                                 static_cast<std::uint32_t>(slots_),
+                                                                 static_cast<std::uint32_t>(width),
+                                                                 static_cast<std::uint32_t>(height),
+                                                                 format, type, row_bytes,
+                                                                 frame_bytes, stride, {0}}};
+      // the readers only trust the ring once every field above is visible
+      header->magic.store(ring_magic, std::memory_order_release);
+      return true;
+#endif
+    }
+
+    bool shared_frame_ring::destroy(){
+      if(!is_created()) return false;
+
+      for(const std::uint64_t ticket : pending_)
+        readbacks_.cancel(ticket);
+      pending_.clear();
+
+#ifndef _WIN32
+      munmap(memory_, memory_size_);
+      shm_unlink(name_.c_str());
+#endif
+      memory_ = nullptr;
+      memory_size_ = 0;
+      name_.clear();
+      width_ = height_ = 0;
+      return true;
+    }
+
+    bool shared_frame_ring::flush(){
+      if(!is_created()) return false;
+
+      while(!pending_.empty())
+        publish(true);
+      return true;
+    }
+
+    bool shared_frame_ring::is_created() const{
+      return memory_ != nullptr;
+    }
+
+    std::uint64_t shared_frame_ring::published() const{
+      return sequence_;
+    }
+
+    const shared_ring_statistics &shared_frame_ring::statistics() const{
+      return statistics_;
+    }
+
+    void shared_frame_ring::update(){
+      while(!pending_.empty() && publish(false)){}
+    }
+
+    bool shared_frame_ring::publish(const bool wait){
+      const std::uint64_t ticket{pending_.front()};
+      if(!wait && !readbacks_.is_ready(ticket)) return false;
+
+      const void *pixels{readbacks_.map(ticket, true)};
+      pending_.pop_front();
+      if(pixels == nullptr){
+        readbacks_.cancel(ticket);
+        ++statistics_.dropped;
+        return true;
+      }
+
+      shared_ring_header *header{reinterpret_cast<shared_ring_header*>(memory_)};
+      const std::uint64_t sequence{++sequence_};
+      std::uint8_t *slot{memory_ + slot_offset(sequence, slots_,
+                                               static_cast<std::size_t>(header->slot_stride))};
+      shared_slot_header *slot_header{reinterpret_cast<shared_slot_header*>(slot)};
+
+      // odd while writing: the readers of the frame this slot held see it changed
+      slot_header->lock.store(2 * sequence - 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      std::memcpy(slot + slot_header_bytes, pixels,
+                  std::min(readbacks_.size(ticket), static_cast<std::size_t>(header->frame_bytes)));
+      slot_header->sequence = sequence;
+      slot_header->timestamp = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()).count());
+      slot_header->lock.store(2 * sequence, std::memory_order_release);
+      header->latest.store(sequence, std::memory_order_release);
+
+      readbacks_.release(ticket);
+      ++statistics_.published;
+      return true;
+    }
+
+    bool shared_frame_ring::submit(const std::uint64_t ticket){
+      if(ticket == 0) return false;
+      pending_.push_back(ticket);
+      ++statistics_.captured;
+      return true;
+    }
+
+    shared_frame_reader::shared_frame_reader() :
+      memory_(nullptr),
+      memory_size_(0)
+    {}
+
+    shared_frame_reader::~shared_frame_reader(){
+      close();
+    }
+
+    bool shared_frame_reader::acquire(shared_frame &frame) const{
+      if(!is_open()) return false;
+
+      const shared_ring_header *header{reinterpret_cast<const shared_ring_header*>(memory_)};
+      const std::uint64_t sequence{header->latest.load(std::memory_order_acquire)};
+      if(sequence == 0) return false;
+
+      const shared_slot_header *slot_header{slot(sequence)};
+      if(slot_header->lock.load(std::memory_order_acquire) != 2 * sequence) return false;
+
+      frame.pixels = reinterpret_cast<const std::uint8_t*>(slot_header) + slot_header_bytes;
+      frame.sequence = sequence;
+      frame.timestamp = slot_header->timestamp;
+      frame.width = static_cast<GLsizei>(header->width);
+      frame.height = static_cast<GLsizei>(header->height);
+      frame.format = header->format;
+      frame.type = header->type;
+      frame.row_bytes = static_cast<std::size_t>(header->row_bytes);
+      frame.size = static_cast<std::size_t>(header->frame_bytes);
+      return true;
+    }
+
+    bool shared_frame_reader::close(){
+      if(!is_open()) return false;
+
+#ifndef _WIN32
+      munmap(const_cast<std::uint8_t*>(memory_), memory_size_);
+#endif
+      memory_ = nullptr;
+      memory_size_ = 0;
+      return true;
+    }
+
+    bool shared_frame_reader::copy(const shared_frame &frame, void *destination) const{
+      if(!is_open() || frame.pixels == nullptr || destination == nullptr) return false;
+
+      std::memcpy(destination, frame.pixels, frame.size);
+      return is_valid(frame);
+    }
+
+    bool shared_frame_reader::is_valid(const shared_frame &frame) const{
+      if(!is_open() || frame.sequence == 0) return false;
+
+      // the pixels were read before checking that the producer did not touch the slot
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return slot(frame.sequence)->lock.load(std::memory_order_relaxed) == 2 * frame.sequence;
+    }
+
+    bool shared_frame_reader::is_open() const{
+      return memory_ != nullptr;
+    }
+
+    std::uint64_t shared_frame_reader::latest() const{
+      if(!is_open()) return 0;
+      return reinterpret_cast<const shared_ring_header*>(memory_)->latest.load(
+        std::memory_order_acquire);
+    }
+
+    bool shared_frame_reader::open(const std::string &name){
+#ifdef _WIN32
+      static_cast<void>(name);
+      return false;
+#else
+      if(is_open() || name.empty()) return false;
+
+      const int descriptor{shm_open(name.c_str(), O_RDONLY, 0)};
+      if(descriptor < 0) return false;
+      struct stat status;
+      if(fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) < ring_page){
+        ::close(descriptor);
+        return false;
+      }
+      const std::size_t size{static_cast<std::size_t>(status.st_size)};
+      void *memory{mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0)};
+      ::close(descriptor);
+      if(memory == MAP_FAILED) return false;
+
+      const shared_ring_header *header{static_cast<const shared_ring_header*>(memory)};
+      if(header->magic.load(std::memory_order_acquire) != ring_magic
+         || header->version != ring_version || header->slots == 0
+         || header->slot_stride < slot_header_bytes + header->frame_bytes
+         || ring_page + header->slots * header->slot_stride > size){
+        munmap(memory, size);
+        return false;
+      }
+
+      memory_ = static_cast<const std::uint8_t*>(memory);
+      memory_size_ = size;
+      return true;
+#endif
+    }
+
+    const shared_slot_header *shared_frame_reader::slot(const std::uint64_t sequence) const{
+      const shared_ring_header *header{reinterpret_cast<const shared_ring_header*>(memory_)};
+      return reinterpret_cast<const shared_slot_header*>(
+        memory_ + slot_offset(sequence, header->slots,
+                              static_cast<std::size_t>(header->slot_stride)));
+    }
+  } // namespace: gl
+} // namespace: ramrod
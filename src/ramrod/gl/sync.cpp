@@ -0,0 +1,142 @@
+#include "ramrod/gl/sync.h"
+
+namespace ramrod {
+  namespace gl {
+    sync::sync(const bool insert) :
+      id_(nullptr),
+      flushed_(false),
+      signaled_(false)
+    {
+      if(insert)
+        this->insert();
+    }
+
+    sync::~sync(){
+      delete_sync();
+    }
+
+    bool sync::delete_sync(){
+      if(id_ == nullptr) return false;
+      glDeleteSync(id_);
+      id_ = nullptr;
+      flushed_ = signaled_ = false;
+      return true;
+    }
+
+    bool sync::finish(){
+      fence::status status{wait(0)};
+      // one millisecond at a time, a single long wait could not be interrupted
+      while(status == fence::status::timeout)
+        status = wait(1000000);
+      return status != fence::status::failed;
+    }
+
+    GLsync sync::id() const{
+      return id_;
+    }
+
+    bool sync::insert(){
+      delete_sync();
+      id_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      return id_ != nullptr;
+    }
+
+    bool sync::is_created() const{
+      return id_ != nullptr;
+    }
+
+    bool sync::is_signaled(){
+      if(id_ == nullptr || signaled_) return true;
+
+      GLint status{GL_UNSIGNALED};
+      glGetSynciv(id_, GL_SYNC_STATUS, 1, nullptr, &status);
+      signaled_ = status == GL_SIGNALED;
+      return signaled_;
+    }
+
+    bool sync::server_wait(){
+      if(id_ == nullptr) return false;
+      glWaitSync(id_, 0, GL_TIMEOUT_IGNORED);
+      return true;
+    }
+
+    fence::status sync::wait(const GLuint64 timeout){
+      if(id_ == nullptr) return fence::status::none;
+      if(signaled_) return fence::status::signaled;
+
+      const GLenum result{glClientWaitSync(id_, flushed_ ? 0 : GL_SYNC_FLUSH_COMMANDS_BIT,
+                                           timeout)};
+      flushed_ = true;
+      switch(result){
+        case GL_ALREADY_SIGNALED: case GL_CONDITION_SATISFIED:
+          signaled_ = true;
+          return fence::status::signaled;
+        case GL_TIMEOUT_EXPIRED:
+          return fence::status::timeout;
+        default:
+          return fence::status::failed;
+      }
+    }
+
+    fence_timeline::fence_timeline() :
+      in_flight_(),
+      last_(0),
+      completed_(0)
+    {}
+
+    fence_timeline::~fence_timeline(){}
+
+    void fence_timeline::clear(){
+      in_flight_.clear();
+      completed_ = last_;
+    }
+
+    std::uint64_t fence_timeline::completed(){
+      while(!in_flight_.empty() && in_flight_.front().fence.is_signaled()){
+        completed_ = in_flight_.front().point;
+        in_flight_.pop_front();
+      }
+      return completed_;
+    }
+
+    std::uint64_t fence_timeline::insert(){
+      in_flight_.emplace_back();
+      entry &point{in_flight_.back()};
+      if(!point.fence.insert()){
+        in_flight_.pop_back();
+        return 0;
+      }
+      point.point = ++last_;
+      return last_;
+    }
+
+    bool fence_timeline::is_complete(const std::uint64_t point){
+      return point <= completed_ || point <= completed();
+    }
+
+    std::uint64_t fence_timeline::last() const{
+      return last_;
+    }
+
+    std::size_t fence_timeline::pending() const{
+      return in_flight_.size();
+    }
+
+    fence::status fence_timeline::wait(const std::uint64_t point, const GLuint64 timeout){
+      if(point == 0 || point > last_) return fence::status::none;
+      if(point <= completed_) return fence::status::signaled;
+
+      std::size_t index{0};
+      while(in_flight_[index].point != point) ++index;
+
+      const fence::status status{in_flight_[index].fence.wait(timeout)};
+      if(status == fence::status::signaled){
+        // the older fences are signaled as well
+        for(std::size_t i = 0; i <= index; ++i)
+          in_flight_.pop_front();
+        completed_ = point;
+      }
+      return status;
+    }
+  } // namespace: gl
+} // namespace: ramrod
@@ -1,11 +1,118 @@
 #include "ramrod/gl/texture.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "ramrod/gl/block_compressor.h"
+#include "ramrod/gl/pixel_conversion.h"
+#include "ramrod/gl/sampler.h"
+#include "ramrod/gl/texture_units.h"
+
 namespace ramrod{
   namespace gl {
+    namespace {
+      // Bits used by a texel, 0 for compressed formats
+      std::size_t texel_bits(const GLint internal_format){
+        switch(internal_format){
+          case GL_R8: case GL_R8_SNORM: case GL_R8I: case GL_R8UI: case GL_RED:
+          case GL_STENCIL_INDEX8:
+          return 8;
+          case GL_RG8: case GL_RG8_SNORM: case GL_RG8I: case GL_RG8UI: case GL_RG:
+          case GL_R16: case GL_R16_SNORM: case GL_R16I: case GL_R16UI: case GL_R16F:
+          case GL_RGB565: case GL_RGB5_A1: case GL_RGBA4: case GL_DEPTH_COMPONENT16:
+          return 16;
+          case GL_RGB8: case GL_RGB8_SNORM: case GL_RGB8I: case GL_RGB8UI: case GL_SRGB8:
+          case GL_RGB: case GL_RGBA8: case GL_RGBA8_SNORM: case GL_RGBA8I: case GL_RGBA8UI:
+          case GL_SRGB8_ALPHA8: case GL_RGBA: case GL_RGB10_A2: case GL_RGB10_A2UI:
+          case GL_R11F_G11F_B10F: case GL_RGB9_E5: case GL_RG16: case GL_RG16_SNORM:
+          case GL_RG16I: case GL_RG16UI: case GL_RG16F: case GL_R32I: case GL_R32UI:
+          case GL_R32F: case GL_DEPTH_COMPONENT24: case GL_DEPTH_COMPONENT32:
+          case GL_DEPTH_COMPONENT32F: case GL_DEPTH24_STENCIL8: case GL_DEPTH_COMPONENT:
+          case GL_DEPTH_STENCIL:
+          return 32;
+          case GL_RGB16: case GL_RGB16_SNORM: case GL_RGB16I: case GL_RGB16UI: case GL_RGB16F:
+          case GL_RGBA16: case GL_RGBA16_SNORM: case GL_RGBA16I: case GL_RGBA16UI:
+          case GL_RGBA16F: case GL_RG32I: case GL_RG32UI: case GL_RG32F:
+          case GL_DEPTH32F_STENCIL8:
+          return 64;
+          case GL_RGB32I: case GL_RGB32UI: case GL_RGB32F:
+          return 96;
+          case GL_RGBA32I: case GL_RGBA32UI: case GL_RGBA32F:
+          return 128;
+          default:
+          return 0;
+        }
+      }
+
+      // Bytes used by a 4x4 block, 0 for uncompressed formats
+      std::size_t block_bytes(const GLint internal_format){
+        switch(internal_format){
+          case GL_COMPRESSED_RGB_S3TC_DXT1_EXT: case 0x83F1: // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+          case GL_COMPRESSED_RED_RGTC1: case GL_COMPRESSED_SIGNED_RED_RGTC1:
+          return 8;
+          case 0x83F2: case 0x83F3: // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT and DXT5
+          case GL_COMPRESSED_RG_RGTC2: case GL_COMPRESSED_SIGNED_RG_RGTC2:
+          case GL_COMPRESSED_RGBA_BPTC_UNORM: case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+          case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT: case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+          return 16;
+          default:
+          return 0;
+        }
+      }
+
+      // Expands RGB data read with the current unpack alignment and skips to tightly
+      // packed RGBA rows, returns nullptr if the data cannot be read directly (unpack
+      // buffer bound or custom row length). Upload the result with `unpack_rgba()` set.
+      const void *expand_rgb(const GLsizei width, const GLsizei height, const void *data){
+        GLint unpack_buffer{0}, row_length{0}, alignment{4}, skip_pixels{0}, skip_rows{0};
+        glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpack_buffer);
+        glGetIntegerv(GL_UNPACK_ROW_LENGTH, &row_length);
+        if(data == nullptr || unpack_buffer != 0 || row_length != 0
+           || width <= 0 || height <= 0) return nullptr;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+        glGetIntegerv(GL_UNPACK_SKIP_PIXELS, &skip_pixels);
+        glGetIntegerv(GL_UNPACK_SKIP_ROWS, &skip_rows);
+
+        // reused by every upload of this thread
+        thread_local std::vector<std::uint8_t> scratch;
+        const std::size_t pixels{static_cast<std::size_t>(width)};
+        const std::size_t stride{(pixels * 3 + alignment - 1) / alignment * alignment};
+        scratch.resize(pixels * 4 * static_cast<std::size_t>(height));
+
+        const std::uint8_t *source{static_cast<const std::uint8_t*>(data)
+                                   + static_cast<std::size_t>(skip_rows) * stride
+                                   + static_cast<std::size_t>(skip_pixels) * 3};
+        for(GLsizei row = 0; row < height; ++row)
+          pixel::rgb_to_rgba(source + stride * row, &scratch[pixels * 4 * row], pixels);
+        return scratch.data();
+      }
+
+      // Sets the unpack parameters of tightly packed RGBA rows, returning the previous
+      // alignment, skipped pixels and skipped rows, or restores them
+      void unpack_rgba(GLint (&previous)[3], const bool restore){
+        if(restore){
+          glPixelStorei(GL_UNPACK_ALIGNMENT, previous[0]);
+          glPixelStorei(GL_UNPACK_SKIP_PIXELS, previous[1]);
+          glPixelStorei(GL_UNPACK_SKIP_ROWS, previous[2]);
+          return;
+        }
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &previous[0]);
+        glGetIntegerv(GL_UNPACK_SKIP_PIXELS, &previous[1]);
+        glGetIntegerv(GL_UNPACK_SKIP_ROWS, &previous[2]);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+      }
+    } // namespace
+
     texture::texture(const bool create, const GLuint active_texture,
                      const bool has_mipmap, const GLenum texture_target) :
       id_(0),
       active_texture_(active_texture),
+      width_(0),
+      height_(0),
+      depth_(1),
+      samples_(1),
       data_type_(GL_UNSIGNED_BYTE),
       texture_target_(texture_target),
       internal_format_(GL_RGBA8),
@@ -18,20 +125,22 @@ namespace ramrod{
     }
 
     texture::~texture(){
-      if(id_ > 0)
+      if(id_ > 0){
+        texture_units::current().forget_texture(id_);
         glDeleteTextures(1, &id_);
+      }
     }
 
     void texture::activate(){
-      glActiveTexture(GL_TEXTURE0 + active_texture_);
+      texture_units::current().activate(active_texture_);
     }
 
     void texture::active_texture(){
-      glActiveTexture(GL_TEXTURE0 + active_texture_);
+      texture_units::current().activate(active_texture_);
     }
 
     void texture::active_texture(const GLuint new_active_texture){
-      glActiveTexture(GL_TEXTURE0 + (active_texture_ = new_active_texture));
+      texture_units::current().activate(active_texture_ = new_active_texture);
     }
 
     GLuint texture::active_texture_id(){
@@ -44,6 +153,10 @@ namespace ramrod{
       if(id_ == 0) return false;
       glTexImage2D(texture_target_, level, internal_format_ = internal_format, width, height,
                    0, data_format, data_type_ = data_type, texture_data);
+      if(level == 0){
+        width_ = width;
+        height_ = height;
+      }
       return true;
     }
 
@@ -53,6 +166,7 @@ namespace ramrod{
 
       GLenum data_format{GL_RGBA};
       GLint internal_format{GL_RGBA8};
+      bool expanded_rgb{false};
 
       switch(component_size){
         case 1:
@@ -66,12 +180,36 @@ namespace ramrod{
         case 3:
           data_format = GL_RGB;
           internal_format = GL_RGB8;
+          // four components rows avoid the driver's per texel conversion
+          if(const void *expanded{expand_rgb(width, height, texture_data)}){
+            data_format = GL_RGBA;
+            texture_data = expanded;
+            expanded_rgb = true;
+          }
         break;
         default:
         break;
       }
+      GLint unpack[3]{4, 0, 0};
+      if(expanded_rgb) unpack_rgba(unpack, false);
       glTexImage2D(texture_target_, 0, internal_format_ = internal_format, width, height,
                    0, data_format, data_type_ = GL_UNSIGNED_BYTE, texture_data);
+      if(expanded_rgb) unpack_rgba(unpack, true);
+      width_ = width;
+      height_ = height;
+      return true;
+    }
+
+    bool texture::allocate_compressed(const GLsizei width, const GLsizei height,
+                                      const void *texture_data, const GLsizei size_in_bytes,
+                                      const GLenum internal_format, const GLint level){
+      if(id_ == 0) return false;
+      glCompressedTexImage2D(texture_target_, level, internal_format_ = internal_format,
+                             width, height, 0, size_in_bytes, texture_data);
+      if(level == 0){
+        width_ = width;
+        height_ = height;
+      }
       return true;
     }
 
@@ -86,16 +224,33 @@ namespace ramrod{
     }
 
     void texture::bind(){
-      glBindTexture(texture_target_, id_);
+      texture_units::current().bind(texture_target_, id_);
+    }
+
+    void texture::bind(const sampler &shared_sampler){
+      texture_units &units{texture_units::current()};
+      units.bind(texture_target_, id_);
+      units.bind_sampler(active_texture_, shared_sampler.id());
+    }
+
+    GLuint texture::bind_resident(){
+      return active_texture_ = texture_units::current().acquire(texture_target_, id_);
     }
 
     bool texture::delete_texture(){
       if(id_ == 0) return false;
+      texture_units::current().forget_texture(id_);
       glDeleteTextures(1, &id_);
       id_ = 0;
+      width_ = height_ = 0;
+      depth_ = samples_ = 1;
       return true;
     }
 
+    GLsizei texture::depth(){
+      return depth_;
+    }
+
     bool texture::generate(){
       if(id_ == 0){
         glGenTextures(1, &id_);
@@ -110,14 +265,41 @@ namespace ramrod{
       return true;
     }
 
+    bool texture::get_image_when_ready(sync &ready, void *pixels, const GLenum format,
+                                       const GLenum type, const GLint level,
+                                       const GLuint64 timeout){
+      if(id_ == 0) return false;
+
+      const fence::status status{ready.wait(timeout)};
+      if(status == fence::status::timeout || status == fence::status::failed) return false;
+
+      glGetTexImage(texture_target_, level, format, type, pixels);
+      return true;
+    }
+
+    GLsizei texture::height(){
+      return height_;
+    }
+
     GLuint texture::id(){
       return id_;
     }
 
+    GLint texture::internal_format(){
+      return internal_format_;
+    }
+
     void texture::internal_format(const GLint new_internal_format){
       internal_format_ = new_internal_format;
     }
 
+    bool texture::invalidate(const GLint level){
+      if(id_ == 0) return false;
+      if(GLAD_GL_ARB_invalidate_subdata && glInvalidateTexImage != nullptr)
+        glInvalidateTexImage(id_, level);
+      return true;
+    }
+
     GLfloat texture::max_anisotropic_filtering(){
       if(custom_filtering_) return max_filtering_;
       return global_max_filtering_;
@@ -128,6 +310,33 @@ namespace ramrod{
       custom_filtering_ = true;
     }
 
+    std::size_t texture::memory_size(){
+      if(width_ <= 0 || height_ <= 0) return 0;
+
+      const std::size_t bits{texel_bits(internal_format_)};
+      const std::size_t block{block_bytes(internal_format_)};
+      std::size_t width{static_cast<std::size_t>(width_)};
+      std::size_t height{static_cast<std::size_t>(height_)};
+      std::size_t depth{static_cast<std::size_t>(std::max<GLsizei>(1, depth_))};
+      const std::size_t samples{static_cast<std::size_t>(std::max<GLsizei>(1, samples_))};
+      // only 3D textures shrink in depth, array layers and cube faces are kept
+      const bool volume{texture_target_ == GL_TEXTURE_3D};
+      std::size_t size{0};
+
+      while(true){
+        if(block > 0)
+          size += (width + 3) / 4 * ((height + 3) / 4) * block * depth;
+        else
+          size += width * height * depth * samples * (bits > 0 ? bits : 32) / 8;
+
+        if(!has_mipmap_ || (width == 1 && height == 1 && (!volume || depth == 1))) break;
+        width = std::max<std::size_t>(1, width / 2);
+        height = std::max<std::size_t>(1, height / 2);
+        if(volume) depth = std::max<std::size_t>(1, depth / 2);
+      }
+      return size;
+    }
+
     bool texture::mipmap(){
       return has_mipmap_;
     }
@@ -183,7 +392,7 @@ namespace ramrod{
     }
 
     void texture::release(){
-      glBindTexture(texture_target_, 0);
+      texture_units::current().bind(texture_target_, 0);
     }
 
     GLenum texture::texture_target(){
@@ -194,6 +403,10 @@ namespace ramrod{
       texture_target_ = new_texture_target;
     }
 
+    GLsizei texture::width(){
+      return width_;
+    }
+
     bool texture::set_max_filtering(const GLfloat max_filtering){
       if(filtering_initialized_) return false;
 
@@ -0,0 +1,229 @@
+#include "ramrod/gl/texture_residency.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "ramrod/gl/texture.h"
+#include "ramrod/gl/texture_units.h"
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      // textures are released instead of halved once they reach this size
+      constexpr GLsizei minimum_drop_size{32};
+      constexpr GLint maximum_dropped_levels{16};
+
+      GLuint bound_texture(const GLenum target){
+        texture_units &units{texture_units::current()};
+        const GLuint known{units.bound(units.active_unit(), target)};
+        if(known != GL_INVALID_INDEX) return known;
+
+        GLenum binding{GL_TEXTURE_BINDING_2D};
+        switch(target){
+          case GL_TEXTURE_1D: binding = GL_TEXTURE_BINDING_1D; break;
+          case GL_TEXTURE_3D: binding = GL_TEXTURE_BINDING_3D; break;
+          case GL_TEXTURE_1D_ARRAY: binding = GL_TEXTURE_BINDING_1D_ARRAY; break;
+          case GL_TEXTURE_2D_ARRAY: binding = GL_TEXTURE_BINDING_2D_ARRAY; break;
+          case GL_TEXTURE_RECTANGLE: binding = GL_TEXTURE_BINDING_RECTANGLE; break;
+          case GL_TEXTURE_CUBE_MAP: binding = GL_TEXTURE_BINDING_CUBE_MAP; break;
+          case GL_TEXTURE_CUBE_MAP_ARRAY: binding = GL_TEXTURE_BINDING_CUBE_MAP_ARRAY; break;
+        }
+        GLint name{0};
+        glGetIntegerv(binding, &name);
+        return static_cast<GLuint>(name);
+      }
+    } // namespace
+
+    texture_residency::texture_residency(const std::size_t budget_in_bytes,
+                                         const residency::policy policy) :
+      entries_(),
+      recent_(),
+      budget_(budget_in_bytes),
+      policy_(policy),
+      statistics_()
+    {}
+
+    texture_residency::~texture_residency(){}
+
+    bool texture_residency::add(texture &target, const reload_callback &reload){
+      if(!reload || entries_.count(&target) > 0) return false;
+
+      entry &item{entries_[&target]};
+      item.target = &target;
+      item.reload = reload;
+      item.bytes = 0;
+      item.dropped_levels = 0;
+      item.resident = false;
+
+      if(target.id() > 0 && target.memory_size() > 0){
+        item.bytes = target.memory_size();
+        item.resident = true;
+        item.position = recent_.insert(recent_.begin(), &target);
+        statistics_.bytes_resident += item.bytes;
+        ++statistics_.textures_resident;
+        enforce(&target);
+      }
+      return true;
+    }
+
+    bool texture_residency::bind(texture &target){
+      const auto found{entries_.find(&target)};
+      if(found == entries_.end()) return false;
+      entry &item{found->second};
+
+      if(item.resident){
+        ++statistics_.hits;
+        recent_.splice(recent_.begin(), recent_, item.position);
+
+        // a degraded texture gets one level back when the budget allows it
+        if(item.dropped_levels > 0
+           && statistics_.bytes_resident - item.bytes + item.bytes * 4 <= budget_){
+          unlink(item);
+          --item.dropped_levels;
+          target.delete_texture();
+          if(!load(item, true)) return false;
+          ++statistics_.restores;
+        }
+        target.bind();
+        return true;
+      }
+
+      ++statistics_.misses;
+      if(!load(item, true)) return false;
+      enforce(&target);
+      return true;
+    }
+
+    std::size_t texture_residency::budget() const {
+      return budget_;
+    }
+
+    void texture_residency::budget(const std::size_t new_budget_in_bytes){
+      budget_ = new_budget_in_bytes;
+      enforce(nullptr);
+    }
+
+    bool texture_residency::contains(const texture &target) const {
+      return entries_.count(&target) > 0;
+    }
+
+    GLint texture_residency::dropped_levels(const texture &target) const {
+      const auto found{entries_.find(&target)};
+      if(found == entries_.end()) return -1;
+      return found->second.dropped_levels;
+    }
+
+    std::size_t texture_residency::evict(const std::size_t bytes){
+      const std::size_t initial{statistics_.bytes_resident};
+      while(initial - std::min(initial, statistics_.bytes_resident) < bytes)
+        if(!evict_one(nullptr)) break;
+      return initial - std::min(initial, statistics_.bytes_resident);
+    }
+
+    bool texture_residency::is_resident(const texture &target) const {
+      const auto found{entries_.find(&target)};
+      return found != entries_.end() && found->second.resident;
+    }
+
+    residency::policy texture_residency::policy() const {
+      return policy_;
+    }
+
+    void texture_residency::policy(const residency::policy new_policy){
+      policy_ = new_policy;
+    }
+
+    bool texture_residency::remove(const texture &target){
+      const auto found{entries_.find(&target)};
+      if(found == entries_.end()) return false;
+      if(found->second.resident)
+        unlink(found->second);
+      entries_.erase(found);
+      return true;
+    }
+
+    void texture_residency::reset_statistics(){
+      statistics_.hits = 0;
+      statistics_.misses = 0;
+      statistics_.evictions = 0;
+      statistics_.mip_drops = 0;
+      statistics_.restores = 0;
+    }
+
+    const residency_statistics &texture_residency::statistics() const {
+      return statistics_;
+    }
+
+    void texture_residency::enforce(const texture *keep){
+      while(statistics_.bytes_resident > budget_)
+        if(!evict_one(keep)) break;
+    }
+
+    bool texture_residency::evict_one(const texture *keep){
+      if(recent_.empty()) return false;
+
+      auto victim{std::prev(recent_.end())};
+      if(*victim == keep){
+        if(victim == recent_.begin()) return false;
+        --victim;
+      }
+
+      entry &item{entries_[*victim]};
+      texture &target{*item.target};
+      const std::size_t previous_bytes{item.bytes};
+      unlink(item);
+
+      if(policy_ == residency::policy::drop_mip
+         && target.width() > minimum_drop_size && target.height() > minimum_drop_size
+         && item.dropped_levels < maximum_dropped_levels){
+        ++item.dropped_levels;
+        ++statistics_.mip_drops;
+        // reloading binds the victim, the texture bound before is bound again after
+        const GLenum binding_target{target.texture_target()};
+        const GLuint victim_id{target.id()};
+        const GLuint previous{bound_texture(binding_target)};
+        target.delete_texture();
+        // it stays as the least recently used texture so it can be dropped again
+        const bool loaded{load(item, false)};
+        texture_units::current().bind(binding_target, previous == victim_id ? target.id()
+                                                                            : previous);
+        if(loaded){
+          if(item.bytes < previous_bytes) return true;
+          unlink(item);
+        }
+      }
+
+      // a released texture comes back with its full resolution
+      target.delete_texture();
+      item.dropped_levels = 0;
+      ++statistics_.evictions;
+      return true;
+    }
+
+    bool texture_residency::load(entry &item, const bool most_recent){
+      texture &target{*item.target};
+      if(target.id() == 0 && !target.generate()) return false;
+
+      target.bind();
+      if(!item.reload(target, item.dropped_levels)){
+        target.delete_texture();
+        return false;
+      }
+
+      item.bytes = target.memory_size();
+      item.resident = true;
+      item.position = recent_.insert(most_recent ? recent_.begin() : recent_.end(), &target);
+      statistics_.bytes_resident += item.bytes;
+      ++statistics_.textures_resident;
+      return true;
+    }
+
+    void texture_residency::unlink(entry &item){
+      if(!item.resident) return;
+      recent_.erase(item.position);
+      item.resident = false;
+      statistics_.bytes_resident -= item.bytes;
+      --statistics_.textures_resident;
+    }
+  } // namespace: gl
+} // namespace: ramrod
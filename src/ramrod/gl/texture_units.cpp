@@ -0,0 +1,179 @@
+#include "ramrod/gl/texture_units.h"
+
+#include <algorithm>
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      constexpr GLuint unknown{GL_INVALID_INDEX};
+      constexpr int target_count{11};
+    } // namespace
+
+    texture_units::texture_units() :
+      textures_(),
+      samplers_(),
+      last_use_(),
+      active_(unknown),
+      units_(0),
+      lru_first_(0),
+      lru_count_(0),
+      clock_(0),
+      redundant_(0)
+    {}
+
+    texture_units::~texture_units(){
+      if(current_ == this)
+        current_ = nullptr;
+    }
+
+    GLuint texture_units::acquire(const GLenum target, const GLuint texture_id){
+      const int index{target_index(target)};
+      initialize();
+
+      const GLuint first{std::min(lru_first_, units_)};
+      const GLuint last{lru_count_ == 0 ? units_ : std::min(units_, first + lru_count_)};
+
+      if(index < 0 || first >= last){
+        bind(lru_first_, target, texture_id);
+        return lru_first_;
+      }
+
+      GLuint oldest{first};
+      for(GLuint unit = first; unit < last; ++unit){
+        if(textures_[slot(unit, index)] == texture_id){
+          last_use_[unit] = ++clock_;
+          ++redundant_;
+          return unit;
+        }
+        if(last_use_[unit] < last_use_[oldest])
+          oldest = unit;
+      }
+
+      bind(oldest, target, texture_id);
+      return oldest;
+    }
+
+    bool texture_units::activate(const GLuint unit){
+      initialize();
+      if(unit == active_){
+        ++redundant_;
+        return false;
+      }
+      glActiveTexture(GL_TEXTURE0 + (active_ = unit));
+      return true;
+    }
+
+    GLuint texture_units::active_unit() const {
+      return active_;
+    }
+
+    bool texture_units::bind(const GLenum target, const GLuint texture_id){
+      return bind_slot(target, target_index(target), texture_id);
+    }
+
+    bool texture_units::bind(const GLuint unit, const GLenum target, const GLuint texture_id){
+      activate(unit);
+      return bind(target, texture_id);
+    }
+
+    bool texture_units::bind_sampler(const GLuint unit, const GLuint sampler_id){
+      if(!initialize() || unit >= units_){
+        glBindSampler(unit, sampler_id);
+        return true;
+      }
+      if(samplers_[unit] == sampler_id){
+        ++redundant_;
+        return false;
+      }
+      glBindSampler(unit, samplers_[unit] = sampler_id);
+      return true;
+    }
+
+    GLuint texture_units::bound(const GLuint unit, const GLenum target) const {
+      const int index{target_index(target)};
+      if(index < 0 || unit >= units_) return unknown;
+      return textures_[slot(unit, index)];
+    }
+
+    void texture_units::forget_sampler(const GLuint sampler_id){
+      if(sampler_id == 0) return;
+      std::replace(samplers_.begin(), samplers_.end(), sampler_id, 0u);
+    }
+
+    void texture_units::forget_texture(const GLuint texture_id){
+      if(texture_id == 0) return;
+      // deleted textures revert their bindings to the default texture
+      std::replace(textures_.begin(), textures_.end(), texture_id, 0u);
+    }
+
+    void texture_units::invalidate(){
+      std::fill(textures_.begin(), textures_.end(), unknown);
+      std::fill(samplers_.begin(), samplers_.end(), unknown);
+      active_ = unknown;
+    }
+
+    void texture_units::lru_range(const GLuint first_unit, const GLuint count){
+      lru_first_ = first_unit;
+      lru_count_ = count;
+    }
+
+    std::size_t texture_units::redundant_calls() const {
+      return redundant_;
+    }
+
+    GLuint texture_units::unit_count() const {
+      return units_;
+    }
+
+    texture_units &texture_units::current(){
+      if(current_ == nullptr){
+        thread_local texture_units thread_default;
+        current_ = &thread_default;
+      }
+      return *current_;
+    }
+
+    void texture_units::make_current(texture_units *table){
+      current_ = table;
+    }
+
+    bool texture_units::bind_slot(const GLenum target, const int index,
+                                  const GLuint texture_id){
+      if(!initialize() || index < 0 || active_ >= units_){
+        glBindTexture(target, texture_id);
+        return true;
+      }
+
+      GLuint &bound_texture{textures_[slot(active_, index)]};
+      last_use_[active_] = ++clock_;
+      if(bound_texture == texture_id){
+        ++redundant_;
+        return false;
+      }
+      glBindTexture(target, bound_texture = texture_id);
+      return true;
+    }
+
+    bool texture_units::initialize(){
+      if(units_ > 0) return true;
+
+      GLint count{0};
+      glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &count);
+      if(count <= 0) return false;
+
+      units_ = static_cast<GLuint>(count);
+      textures_.assign(static_cast<std::size_t>(units_) * target_count, unknown);
+      samplers_.assign(units_, unknown);
+      last_use_.assign(units_, 0);
+      return true;
+    }
+
+    std::size_t texture_units::slot(const GLuint unit, const int target_index) const {
+      return static_cast<std::size_t>(target_index) * units_ + unit;
+    }
+
+    // ::::::::::::::::::::::::::::::: INITIALIZING STATIC VARIABLES ::::::::::::::::::::::::::::::::
+
+    thread_local texture_units *texture_units::current_{nullptr};
+  } // namespace: gl
+} // namespace: ramrod
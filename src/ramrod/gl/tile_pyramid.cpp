@@ -0,0 +1,216 @@
+#include "ramrod/gl/tile_pyramid.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      static_assert(sizeof(tile_pyramid_header) == 56,
+                    "The tile pyramid header must keep the offsets table 8 bytes aligned");
+
+      std::uint32_t tiles_along(const std::uint32_t size, const std::uint32_t level,
+                                const std::uint32_t tile_size){
+        const std::uint32_t level_size{std::max<std::uint32_t>(1, size >> level)};
+        return (level_size + tile_size - 1) / tile_size;
+      }
+
+      bool valid_header(const tile_pyramid_header &header){
+        return header.width > 0 && header.height > 0 && header.tile_size > 0
+            && header.levels > 0 && header.levels <= 32 && header.bytes_per_tile > 0;
+      }
+
+      std::size_t total_tiles(const tile_pyramid_header &header){
+        std::size_t total{0};
+        for(std::uint32_t level = 0; level < header.levels; ++level)
+          total += static_cast<std::size_t>(tiles_along(header.width, level, header.tile_size))
+                   * tiles_along(header.height, level, header.tile_size);
+        return total;
+      }
+    } // namespace
+
+    tile_pyramid::tile_pyramid() :
+      header_(),
+      map_(nullptr),
+      size_(0),
+      offsets_(nullptr),
+      level_start_(),
+      contents_()
+    {}
+
+    tile_pyramid::~tile_pyramid(){
+      close();
+    }
+
+    bool tile_pyramid::close(){
+      if(map_ == nullptr) return false;
+#ifdef _WIN32
+      contents_ = std::vector<unsigned char>();
+#else
+      munmap(const_cast<unsigned char*>(map_), size_);
+#endif
+      map_ = nullptr;
+      offsets_ = nullptr;
+      size_ = 0;
+      level_start_.clear();
+      return true;
+    }
+
+    const tile_pyramid_header &tile_pyramid::header() const {
+      return header_;
+    }
+
+    bool tile_pyramid::is_open() const {
+      return map_ != nullptr;
+    }
+
+    bool tile_pyramid::open(const std::string &path){
+      close();
+
+#ifdef _WIN32
+      // there is no mapping, the whole file is read once
+      std::ifstream file(path, std::ios::binary | std::ios::ate);
+      if(!file.is_open()) return false;
+
+      const std::size_t size{static_cast<std::size_t>(file.tellg())};
+      if(size < sizeof(tile_pyramid_header)) return false;
+      contents_.resize(size);
+      file.seekg(0);
+      if(!file.read(reinterpret_cast<char*>(contents_.data()), static_cast<std::streamsize>(size))){
+        contents_ = std::vector<unsigned char>();
+        return false;
+      }
+      map_ = contents_.data();
+#else
+      const int file{::open(path.c_str(), O_RDONLY)};
+      if(file < 0) return false;
+
+      struct stat information;
+      if(fstat(file, &information) != 0
+         || static_cast<std::size_t>(information.st_size) < sizeof(tile_pyramid_header)){
+        ::close(file);
+        return false;
+      }
+
+      const std::size_t size{static_cast<std::size_t>(information.st_size)};
+      void *map{mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0)};
+      // the mapping keeps its own reference to the file
+      ::close(file);
+      if(map == MAP_FAILED) return false;
+
+      // tiles are requested in the order the camera sees them
+      madvise(map, size, MADV_RANDOM);
+      map_ = static_cast<const unsigned char*>(map);
+#endif
+      size_ = size;
+
+      std::memcpy(&header_, map_, sizeof(tile_pyramid_header));
+      const tile_pyramid_header reference;
+      const std::size_t tiles{valid_header(header_) ? total_tiles(header_) : 0};
+
+      if(std::memcmp(header_.magic, reference.magic, sizeof(reference.magic)) != 0 || tiles == 0
+         || sizeof(tile_pyramid_header) + tiles * sizeof(std::uint64_t) > size){
+        close();
+        return false;
+      }
+
+      offsets_ = reinterpret_cast<const std::uint64_t*>(map_ + sizeof(tile_pyramid_header));
+
+      level_start_.assign(header_.levels + 1, 0);
+      for(std::uint32_t level = 0; level < header_.levels; ++level)
+        level_start_[level + 1] = level_start_[level]
+                                  + static_cast<std::size_t>(tiles_x(level)) * tiles_y(level);
+      return true;
+    }
+
+    void tile_pyramid::prefetch(const std::uint32_t level, const std::uint32_t x,
+                                const std::uint32_t y) const {
+#ifdef _WIN32
+      // the file was read by open(), the tiles are already in memory
+      static_cast<void>(level);
+      static_cast<void>(x);
+      static_cast<void>(y);
+#else
+      const unsigned char *data{static_cast<const unsigned char*>(tile(level, x, y))};
+      if(data == nullptr) return;
+
+      const std::size_t page{static_cast<std::size_t>(sysconf(_SC_PAGESIZE))};
+      const std::size_t first{static_cast<std::size_t>(data - map_) / page * page};
+      const std::size_t last{static_cast<std::size_t>(data - map_) + header_.bytes_per_tile};
+      madvise(const_cast<unsigned char*>(map_) + first, last - first, MADV_WILLNEED);
+#endif
+    }
+
+    const void *tile_pyramid::tile(const std::uint32_t level, const std::uint32_t x,
+                                   const std::uint32_t y) const {
+      if(map_ == nullptr || level >= header_.levels
+         || x >= tiles_x(level) || y >= tiles_y(level)) return nullptr;
+
+      const std::uint64_t offset{offsets_[tile_index(level, x, y)]};
+      if(offset == 0 || offset + header_.bytes_per_tile > size_) return nullptr;
+      return map_ + offset;
+    }
+
+    std::uint32_t tile_pyramid::tiles_x(const std::uint32_t level) const {
+      if(level >= header_.levels || header_.tile_size == 0) return 0;
+      return tiles_along(header_.width, level, header_.tile_size);
+    }
+
+    std::uint32_t tile_pyramid::tiles_y(const std::uint32_t level) const {
+      if(level >= header_.levels || header_.tile_size == 0) return 0;
+      return tiles_along(header_.height, level, header_.tile_size);
+    }
+
+    bool tile_pyramid::write(const std::string &path, const tile_pyramid_header &header,
+                             const tile_writer &fill){
+      if(!valid_header(header) || !fill) return false;
+
+      tile_pyramid_header stored{header};
+      std::memcpy(stored.magic, tile_pyramid_header().magic, sizeof(stored.magic));
+
+      std::ofstream file(path, std::ios::binary | std::ios::trunc);
+      if(!file.is_open()) return false;
+
+      std::vector<std::uint64_t> offsets(total_tiles(stored), 0);
+      std::vector<unsigned char> data(stored.bytes_per_tile);
+      std::uint64_t position{sizeof(tile_pyramid_header) + offsets.size() * sizeof(std::uint64_t)};
+
+      file.write(reinterpret_cast<const char*>(&stored), sizeof(tile_pyramid_header));
+      file.write(reinterpret_cast<const char*>(offsets.data()),
+                 static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)));
+
+      std::size_t index{0};
+      for(std::uint32_t level = 0; level < stored.levels; ++level){
+        const std::uint32_t columns{tiles_along(stored.width, level, stored.tile_size)};
+        const std::uint32_t rows{tiles_along(stored.height, level, stored.tile_size)};
+
+        for(std::uint32_t y = 0; y < rows; ++y)
+          for(std::uint32_t x = 0; x < columns; ++x, ++index){
+            if(!fill(level, x, y, data.data())) continue;
+            offsets[index] = position;
+            file.write(reinterpret_cast<const char*>(data.data()),
+                       static_cast<std::streamsize>(data.size()));
+            position += data.size();
+          }
+      }
+
+      file.seekp(sizeof(tile_pyramid_header));
+      file.write(reinterpret_cast<const char*>(offsets.data()),
+                 static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)));
+      return file.good();
+    }
+
+    std::size_t tile_pyramid::tile_index(const std::uint32_t level, const std::uint32_t x,
+                                         const std::uint32_t y) const {
+      return level_start_[level] + static_cast<std::size_t>(y) * tiles_x(level) + x;
+    }
+  } // namespace: gl
+} // namespace: ramrod
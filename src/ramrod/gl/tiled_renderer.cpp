@@ -0,0 +1,240 @@
+#include "ramrod/gl/tiled_renderer.h"
+
+#include <algorithm>
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      // images bigger than 2 GiB need 64 bits offsets
+      bool seek(std::FILE *file, const long long offset){
+#ifdef _WIN32
+        return _fseeki64(file, offset, SEEK_SET) == 0;
+#else
+        return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+      }
+    }
+
+    tiled_renderer::tiled_renderer(render_target_pool &pool, const GLsizei tile_size,
+                                   const std::size_t slots) :
+      pool_(pool),
+      readbacks_(slots == 0 ? 1 : slots),
+      slots_(slots == 0 ? 1 : slots),
+      pending_(),
+      color_(nullptr),
+      depth_(nullptr),
+      frame_(nullptr),
+      file_(nullptr),
+      header_bytes_(0),
+      requested_size_(tile_size),
+      tile_size_(0),
+      width_(0),
+      height_(0),
+      columns_(0),
+      rows_(0),
+      index_(0),
+      previous_frame_buffer_(0),
+      previous_viewport_{0, 0, 0, 0},
+      drawing_(false),
+      failed_(false),
+      statistics_()
+    {}
+
+    tiled_renderer::~tiled_renderer(){
+      end();
+    }
+
+    bool tiled_renderer::begin(const std::string &path, const GLsizei width,
+                               const GLsizei height, const bool header){
+      if(file_ != nullptr || path.empty() || width <= 0 || height <= 0) return false;
+
+      GLint maximum_render{0}, maximum_viewport[2]{0, 0};
+      glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &maximum_render);
+      glGetIntegerv(GL_MAX_VIEWPORT_DIMS, maximum_viewport);
+      tile_size_ = std::min({requested_size_ > 0 ? requested_size_ : 2048, maximum_render,
+                             maximum_viewport[0], maximum_viewport[1], std::max(width, height)});
+      if(tile_size_ <= 0) return false;
+
+      glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_frame_buffer_);
+      glGetIntegerv(GL_VIEWPORT, previous_viewport_);
+
+      color_ = pool_.acquire({tile_size_, tile_size_, GL_RGBA8, 0, false});
+      depth_ = pool_.acquire({tile_size_, tile_size_, GL_DEPTH24_STENCIL8, 0, false});
+      if(color_ != nullptr && depth_ != nullptr)
+        frame_ = pool_.acquire_frame_buffer({color_}, depth_);
+      glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_frame_buffer_));
+      if(frame_ != nullptr) file_ = std::fopen(path.c_str(), "wb");
+
+      if(file_ == nullptr){
+        if(color_ != nullptr) pool_.release(color_);
+        if(depth_ != nullptr) pool_.release(depth_);
+        color_ = depth_ = nullptr;
+        frame_ = nullptr;
+        return false;
+      }
+
+      header_bytes_ = 0;
+      if(header){
+        const int written{std::fprintf(file_, "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\nMAXVAL 255\n"
+                                              "TUPLTYPE RGB_ALPHA\nENDHDR\n", width, height)};
+        header_bytes_ = written > 0 ? written : 0;
+        failed_ = written <= 0;
+      }else{
+        failed_ = false;
+      }
+
+      width_ = width;
+      height_ = height;
+      columns_ = static_cast<std::size_t>((width + tile_size_ - 1) / tile_size_);
+      rows_ = static_cast<std::size_t>((height + tile_size_ - 1) / tile_size_);
+      index_ = 0;
+      drawing_ = false;
+      statistics_ = tiled_statistics();
+      return true;
+    }
+
+    std::size_t tiled_renderer::columns() const{
+      return columns_;
+    }
+
+    bool tiled_renderer::end(){
+      if(file_ == nullptr) return false;
+
+      if(drawing_){
+        // the last tile was drawn but not read
+        drawing_ = false;
+        restore();
+      }
+      bool success{!failed_ && index_ == columns_ * rows_ && write_ready(true)};
+      for(const pending &item : pending_)
+        readbacks_.cancel(item.ticket);
+      pending_.clear();
+
+      if(std::fclose(file_) != 0) success = false;
+      file_ = nullptr;
+      pool_.release(color_);
+      pool_.release(depth_);
+      color_ = depth_ = nullptr;
+      frame_ = nullptr;
+      return success;
+    }
+
+    bool tiled_renderer::next(image_tile &tile){
+      if(file_ == nullptr) return false;
+
+      if(drawing_){
+        drawing_ = false;
+        if(pending_.size() >= slots_){
+          ++statistics_.stalls;
+          if(!write(pending_.front())) failed_ = true;
+          pending_.pop_front();
+        }
+
+        const image_tile drawn{layout(index_)};
+        const std::uint64_t ticket{readbacks_.read(*frame_, GL_COLOR_ATTACHMENT0, 0, 0,
+                                                   drawn.width, drawn.height,
+                                                   GL_RGBA, GL_UNSIGNED_BYTE)};
+        if(ticket == 0) failed_ = true;
+        else pending_.push_back({ticket, drawn});
+
+        // the copy is already queued, the depth does not need to be stored
+        const GLenum depth_attachment{GL_DEPTH_STENCIL_ATTACHMENT};
+        frame_->bind();
+        frame_->invalidate(1, &depth_attachment);
+        ++index_;
+      }
+
+      if(!write_ready(false)) failed_ = true;
+      if(failed_ || index_ >= columns_ * rows_){
+        restore();
+        return false;
+      }
+
+      tile = layout(index_);
+      frame_->bind();
+      glViewport(0, 0, tile.width, tile.height);
+      drawing_ = true;
+      return true;
+    }
+
+    std::size_t tiled_renderer::rows() const{
+      return rows_;
+    }
+
+    const tiled_statistics &tiled_renderer::statistics() const{
+      return statistics_;
+    }
+
+    GLsizei tiled_renderer::tile_size() const{
+      return tile_size_;
+    }
+
+    image_tile tiled_renderer::layout(const std::size_t index) const{
+      image_tile tile;
+      tile.column = index % columns_;
+      tile.row = index / columns_;
+      tile.x = static_cast<GLint>(tile.column) * tile_size_;
+      tile.width = std::min(tile_size_, width_ - tile.x);
+      const GLint top{static_cast<GLint>(tile.row) * tile_size_};
+      tile.height = std::min(tile_size_, height_ - top);
+      tile.y = height_ - top - tile.height;
+
+      // scales and moves the tile's part of the clip space to the whole clip space
+      const GLfloat image_width{static_cast<GLfloat>(width_)};
+      const GLfloat image_height{static_cast<GLfloat>(height_)};
+      tile.projection.fill(0.0f);
+      tile.projection[0] = image_width / tile.width;
+      tile.projection[5] = image_height / tile.height;
+      tile.projection[10] = 1.0f;
+      tile.projection[12] = (image_width - 2.0f * tile.x - tile.width) / tile.width;
+      tile.projection[13] = (image_height - 2.0f * tile.y - tile.height) / tile.height;
+      tile.projection[15] = 1.0f;
+      return tile;
+    }
+
+    void tiled_renderer::restore(){
+      glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_frame_buffer_));
+      glViewport(previous_viewport_[0], previous_viewport_[1],
+                 previous_viewport_[2], previous_viewport_[3]);
+    }
+
+    bool tiled_renderer::write(const pending &item){
+      const std::uint8_t *pixels{static_cast<const std::uint8_t*>(
+                                 readbacks_.map(item.ticket, true))};
+      if(pixels == nullptr){
+        readbacks_.cancel(item.ticket);
+        return false;
+      }
+
+      const std::size_t tile_row{static_cast<std::size_t>(item.tile.width) * 4};
+      const std::size_t row_bytes{item.tile.height > 1 ?
+                                  (readbacks_.size(item.ticket) - tile_row)
+                                  / static_cast<std::size_t>(item.tile.height - 1) : tile_row};
+      bool success{true};
+      // the top row of the tile comes last in memory and first in the file
+      for(GLsizei row = item.tile.height; row-- > 0 && success;){
+        const long long image_row{height_ - 1 - item.tile.y - row};
+        const long long offset{header_bytes_ + (image_row * width_ + item.tile.x) * 4};
+        success = seek(file_, offset)
+                  && std::fwrite(pixels + static_cast<std::size_t>(row) * row_bytes, 1,
+                                 tile_row, file_) == tile_row;
+      }
+      readbacks_.release(item.ticket);
+
+      if(success){
+        ++statistics_.tiles;
+        statistics_.written_bytes += tile_row * static_cast<std::size_t>(item.tile.height);
+      }
+      return success;
+    }
+
+    bool tiled_renderer::write_ready(const bool wait){
+      while(!pending_.empty()){
+        if(!wait && !readbacks_.is_ready(pending_.front().ticket)) break;
+        if(!write(pending_.front())) return false;
+        pending_.pop_front();
+      }
+      return true;
+    }
+  } // namespace: gl
+} // namespace: ramrod
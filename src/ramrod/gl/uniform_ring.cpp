@@ -0,0 +1,161 @@
+#include "ramrod/gl/uniform_ring.h"
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      std::size_t round_up(const std::size_t bytes, const std::size_t alignment){
+        return (bytes + alignment - 1) / alignment * alignment;
+      }
+    }
+
+    uniform_ring::uniform_ring(const std::size_t frames) :
+      buffer_(),
+      fences_(frames == 0 ? 1 : frames),
+      frames_(frames == 0 ? 1 : frames),
+      region_bytes_(0),
+      frame_(0),
+      cursor_(0),
+      mapped_from_(0),
+      alignment_(0),
+      mapped_(nullptr),
+      statistics_()
+    {}
+
+    uniform_ring::~uniform_ring(){
+      flush();
+    }
+
+    GLint uniform_ring::alignment() const{
+      return alignment_;
+    }
+
+    uniform_allocation uniform_ring::allocate(const std::size_t size_in_bytes){
+      uniform_allocation allocation;
+      if(!is_created() || size_in_bytes == 0) return allocation;
+
+      const std::size_t start{round_up(cursor_, static_cast<std::size_t>(alignment_))};
+      if(start + size_in_bytes > region_bytes_){
+        ++statistics_.overflows;
+        return allocation;
+      }
+      // the mapped range starts at the cursor, an aligned start may be past it
+      if(mapped_ == nullptr){
+        cursor_ = start;
+        if(!map()) return allocation;
+      }
+
+      allocation.data = mapped_ + (start - mapped_from_);
+      allocation.offset = static_cast<GLintptr>(frame_ * region_bytes_ + start);
+      allocation.size = static_cast<GLsizeiptr>(size_in_bytes);
+      cursor_ = start + size_in_bytes;
+      ++statistics_.allocations;
+      statistics_.bytes += size_in_bytes;
+      return allocation;
+    }
+
+    bool uniform_ring::begin_frame(){
+      if(!is_created()) return false;
+
+      flush();
+      if(cursor_ > 0) fences_[frame_].insert();
+      ++statistics_.frames;
+
+      frame_ = (frame_ + 1) % frames_;
+      cursor_ = 0;
+      sync &fence{fences_[frame_]};
+      if(fence.is_created()){
+        if(!fence.is_signaled()){
+          ++statistics_.stalls;
+          fence.finish();
+        }
+        fence.delete_sync();
+      }
+      return true;
+    }
+
+    bool uniform_ring::bind(const GLuint index, const uniform_allocation &allocation){
+      if(!is_created() || allocation.size <= 0) return false;
+      // binding a range of a mapped buffer is allowed, drawing from it is not
+      buffer_.bind_range(index, allocation.offset, allocation.size);
+      return true;
+    }
+
+    const uniform_buffer &uniform_ring::buffer() const{
+      return buffer_;
+    }
+
+    std::size_t uniform_ring::capacity() const{
+      return region_bytes_;
+    }
+
+    bool uniform_ring::create(const std::size_t bytes_per_frame){
+      if(is_created() || bytes_per_frame == 0) return false;
+      if(!buffer_.generate()) return false;
+
+      glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment_);
+      if(alignment_ <= 0) alignment_ = 256;
+      region_bytes_ = round_up(bytes_per_frame, static_cast<std::size_t>(alignment_));
+
+      buffer_.bind();
+      buffer_.allocate(nullptr, static_cast<GLsizei>(region_bytes_ * frames_), GL_STREAM_DRAW);
+      frame_ = 0;
+      cursor_ = 0;
+      statistics_ = uniform_ring_statistics();
+      return true;
+    }
+
+    bool uniform_ring::delete_ring(){
+      if(!is_created()) return false;
+      flush();
+      for(sync &fence : fences_)
+        fence.delete_sync();
+      buffer_.delete_buffer();
+      region_bytes_ = 0;
+      alignment_ = 0;
+      cursor_ = 0;
+      return true;
+    }
+
+    bool uniform_ring::flush(){
+      if(mapped_ == nullptr) return false;
+
+      buffer_.bind();
+      // only the written blocks are sent
+      if(cursor_ > mapped_from_)
+        glFlushMappedBufferRange(GL_UNIFORM_BUFFER, 0,
+                                 static_cast<GLsizeiptr>(cursor_ - mapped_from_));
+      glUnmapBuffer(GL_UNIFORM_BUFFER);
+      mapped_ = nullptr;
+      return true;
+    }
+
+    bool uniform_ring::is_created() const{
+      return buffer_.id() > 0;
+    }
+
+    const uniform_ring_statistics &uniform_ring::statistics() const{
+      return statistics_;
+    }
+
+    std::size_t uniform_ring::used() const{
+      return cursor_;
+    }
+
+    bool uniform_ring::map(){
+      // the fence of this region was waited for by begin_frame(), the GPU does not read
+      // the rest of it so the driver does not need to synchronize
+      buffer_.bind();
+      void *pointer{glMapBufferRange(GL_UNIFORM_BUFFER,
+                                     static_cast<GLintptr>(frame_ * region_bytes_ + cursor_),
+                                     static_cast<GLsizeiptr>(region_bytes_ - cursor_),
+                                     GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT
+                                     | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT)};
+      if(pointer == nullptr) return false;
+
+      mapped_ = static_cast<std::uint8_t*>(pointer);
+      mapped_from_ = cursor_;
+      ++statistics_.maps;
+      return true;
+    }
+  } // namespace: gl
+} // namespace: ramrod
@@ -0,0 +1,349 @@
+#include "ramrod/gl/upload_scheduler.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "ramrod/gl/buffer.h"
+#include "ramrod/gl/texture.h"
+#include "ramrod/gl/uniform_buffer.h"
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      // Bytes of a pixel for glTexSubImage2D, 0 if the combination is unknown
+      std::size_t pixel_bytes(const GLenum format, const GLenum type){
+        std::size_t components{0};
+        switch(format){
+          case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+            components = 1;
+          break;
+          case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+            components = 2;
+          break;
+          case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+            components = 3;
+          break;
+          case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+            components = 4;
+          break;
+          default:
+          return 0;
+        }
+
+        switch(type){
+          case GL_UNSIGNED_BYTE: case GL_BYTE:
+          return components;
+          case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+          return components * 2;
+          case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+          return components * 4;
+          case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+          return 1;
+          case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+          case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+          case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+          return 2;
+          case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+          case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+          case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+          case GL_UNSIGNED_INT_24_8:
+          return 4;
+          default:
+          return 0;
+        }
+      }
+
+      std::size_t bucket(const std::size_t value, const std::size_t first_limit){
+        std::size_t index{0};
+        while(index + 1 < upload_statistics::buckets && value >= first_limit << index)
+          ++index;
+        return index;
+      }
+    } // namespace
+
+    upload_scheduler::upload_scheduler(const std::size_t bytes_per_frame,
+                                       const std::chrono::microseconds time_per_frame,
+                                       const std::size_t chunk_bytes) :
+      jobs_(),
+      next_ticket_(1),
+      bytes_per_frame_(bytes_per_frame),
+      chunk_bytes_(std::max<std::size_t>(1, chunk_bytes)),
+      time_per_frame_(time_per_frame),
+      statistics_()
+    {}
+
+    upload_scheduler::~upload_scheduler(){}
+
+    std::size_t upload_scheduler::bytes_per_frame() const {
+      return bytes_per_frame_;
+    }
+
+    void upload_scheduler::bytes_per_frame(const std::size_t new_bytes_per_frame){
+      bytes_per_frame_ = new_bytes_per_frame;
+    }
+
+    bool upload_scheduler::cancel(const std::uint64_t ticket){
+      const auto found{std::find_if(jobs_.begin(), jobs_.end(), [ticket](const job &item){
+        return item.ticket == ticket;
+      })};
+      if(found == jobs_.end()) return false;
+      jobs_.erase(found);
+      return true;
+    }
+
+    std::size_t upload_scheduler::chunk_bytes() const {
+      return chunk_bytes_;
+    }
+
+    void upload_scheduler::chunk_bytes(const std::size_t new_chunk_bytes){
+      chunk_bytes_ = std::max<std::size_t>(1, new_chunk_bytes);
+    }
+
+    std::size_t upload_scheduler::execute(){
+      if(jobs_.empty()) return 0;
+
+      const clock::time_point start{clock::now()};
+
+      GLint unpack_buffer{0}, alignment{4}, array_buffer{0}, uniform_buffer{0}, vertex_array{0};
+      GLint row_length{0}, skip_rows{0}, skip_pixels{0};
+      glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpack_buffer);
+      glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+      glGetIntegerv(GL_UNPACK_ROW_LENGTH, &row_length);
+      glGetIntegerv(GL_UNPACK_SKIP_ROWS, &skip_rows);
+      glGetIntegerv(GL_UNPACK_SKIP_PIXELS, &skip_pixels);
+      glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &array_buffer);
+      glGetIntegerv(GL_UNIFORM_BUFFER_BINDING, &uniform_buffer);
+      glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vertex_array);
+      // queued pointers are client memory with tightly packed rows
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+      glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+      glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+      glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+      glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+
+      std::sort(jobs_.begin(), jobs_.end(), [start](const job &left, const job &right){
+        const bool left_late{left.deadline <= start}, right_late{right.deadline <= start};
+        if(left_late != right_late) return left_late;
+        if(left.priority != right.priority) return left.priority > right.priority;
+        if(left.deadline != right.deadline) return left.deadline < right.deadline;
+        return left.ticket < right.ticket;
+      });
+
+      std::vector<completion_callback> completed;
+      std::size_t sent{0};
+      bool stop{false};
+
+      auto item{jobs_.begin()};
+      while(item != jobs_.end() && !stop){
+        const bool late{item->deadline <= start};
+
+        while(!item->allocated || item->done < item->size){
+          if(!late && sent > 0 && (sent >= bytes_per_frame_
+                                   || clock::now() - start >= time_per_frame_)){
+            stop = true;
+            break;
+          }
+          const std::size_t allowance{late || sent == 0 ?
+                                      std::numeric_limits<std::size_t>::max() :
+                                      bytes_per_frame_ - sent};
+          const bool was_allocated{item->allocated};
+          const std::size_t bytes{step(*item, allowance)};
+          // not even one row fits in what is left of the budget
+          if(bytes == 0 && was_allocated){
+            stop = true;
+            break;
+          }
+          sent += bytes;
+        }
+
+        if(item->allocated && item->done == item->size){
+          const clock::time_point now{clock::now()};
+          const std::size_t waited{static_cast<std::size_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - item->queued).count())};
+          ++statistics_.latency[bucket(waited, 128)];
+          ++statistics_.completed;
+          if(now > item->deadline) ++statistics_.missed_deadlines;
+          if(item->completed) completed.push_back(std::move(item->completed));
+          item = jobs_.erase(item);
+        }else{
+          ++item;
+        }
+      }
+
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, static_cast<GLuint>(unpack_buffer));
+      glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+      glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length);
+      glPixelStorei(GL_UNPACK_SKIP_ROWS, skip_rows);
+      glPixelStorei(GL_UNPACK_SKIP_PIXELS, skip_pixels);
+      glBindBuffer(GL_ARRAY_BUFFER, static_cast<GLuint>(array_buffer));
+      glBindBuffer(GL_UNIFORM_BUFFER, static_cast<GLuint>(uniform_buffer));
+      glBindVertexArray(static_cast<GLuint>(vertex_array));
+
+      statistics_.total_bytes += sent;
+      statistics_.last_frame_bytes = sent;
+      statistics_.last_frame_microseconds = static_cast<std::size_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count());
+      ++statistics_.frame_bytes[bucket(sent, 1024)];
+
+      // callbacks may queue new uploads
+      for(completion_callback &callback : completed)
+        callback();
+      return sent;
+    }
+
+    bool upload_scheduler::is_pending(const std::uint64_t ticket) const {
+      return std::any_of(jobs_.begin(), jobs_.end(), [ticket](const job &item){
+        return item.ticket == ticket;
+      });
+    }
+
+    std::size_t upload_scheduler::pending() const {
+      return jobs_.size();
+    }
+
+    std::size_t upload_scheduler::pending_bytes() const {
+      std::size_t bytes{0};
+      for(const job &item : jobs_)
+        bytes += (item.size - item.done) * (item.type == kind::image ? item.row_bytes : 1);
+      return bytes;
+    }
+
+    void upload_scheduler::reset_statistics(){
+      statistics_ = upload_statistics();
+    }
+
+    const upload_statistics &upload_scheduler::statistics() const {
+      return statistics_;
+    }
+
+    std::chrono::microseconds upload_scheduler::time_per_frame() const {
+      return time_per_frame_;
+    }
+
+    void upload_scheduler::time_per_frame(const std::chrono::microseconds new_time_per_frame){
+      time_per_frame_ = new_time_per_frame;
+    }
+
+    std::uint64_t upload_scheduler::upload_array(buffer &target, const void *data,
+                                                 const GLsizei size_in_bytes, const GLenum usage,
+                                                 const int priority,
+                                                 const clock::time_point deadline,
+                                                 const completion_callback &completed){
+      if(target.id_array() == 0 || data == nullptr || size_in_bytes <= 0) return 0;
+      return enqueue({0, kind::array, &target, static_cast<const std::uint8_t*>(data),
+                      static_cast<std::size_t>(size_in_bytes), 0, 1, 0, GL_NONE, GL_NONE,
+                      usage, 0, 0, false, priority, clock::now(), deadline, completed});
+    }
+
+    std::uint64_t upload_scheduler::upload_element(buffer &target, const void *data,
+                                                   const GLsizei size_in_bytes,
+                                                   const GLenum usage, const int priority,
+                                                   const clock::time_point deadline,
+                                                   const completion_callback &completed){
+      if(target.id_element() == 0 || data == nullptr || size_in_bytes <= 0) return 0;
+      return enqueue({0, kind::element, &target, static_cast<const std::uint8_t*>(data),
+                      static_cast<std::size_t>(size_in_bytes), 0, 1, 0, GL_NONE, GL_NONE,
+                      usage, 0, 0, false, priority, clock::now(), deadline, completed});
+    }
+
+    std::uint64_t upload_scheduler::upload_texture(texture &target, const GLsizei width,
+                                                   const GLsizei height, const void *data,
+                                                   const GLenum format, const GLenum type,
+                                                   const GLint internal_format,
+                                                   const GLint level, const int priority,
+                                                   const clock::time_point deadline,
+                                                   const completion_callback &completed){
+      const std::size_t bytes{pixel_bytes(format, type)};
+      if(target.id() == 0 || data == nullptr || width <= 0 || height <= 0 || bytes == 0)
+        return 0;
+      return enqueue({0, kind::image, &target, static_cast<const std::uint8_t*>(data),
+                      static_cast<std::size_t>(height), 0,
+                      bytes * static_cast<std::size_t>(width), width, format, type, GL_NONE,
+                      internal_format, level, false, priority, clock::now(), deadline,
+                      completed});
+    }
+
+    std::uint64_t upload_scheduler::upload_uniform(uniform_buffer &target, const void *data,
+                                                   const GLsizei size_in_bytes,
+                                                   const GLenum usage, const int priority,
+                                                   const clock::time_point deadline,
+                                                   const completion_callback &completed){
+      if(data == nullptr || size_in_bytes <= 0) return 0;
+      return enqueue({0, kind::uniform, &target, static_cast<const std::uint8_t*>(data),
+                      static_cast<std::size_t>(size_in_bytes), 0, 1, 0, GL_NONE, GL_NONE,
+                      usage, 0, 0, false, priority, clock::now(), deadline, completed});
+    }
+
+    std::uint64_t upload_scheduler::enqueue(job &&item){
+      item.ticket = next_ticket_++;
+      jobs_.push_back(std::move(item));
+      return jobs_.back().ticket;
+    }
+
+    std::size_t upload_scheduler::step(job &item, const std::size_t max_bytes){
+      if(item.type == kind::image){
+        texture &target{*static_cast<texture*>(item.target)};
+        target.bind();
+
+        if(!item.allocated){
+          target.allocate(item.width, static_cast<GLsizei>(item.size), nullptr, item.format,
+                          item.pixel_type, item.internal_format, item.level);
+          item.allocated = true;
+          return 0;
+        }
+
+        const std::size_t band{std::max<std::size_t>(1, chunk_bytes_ / item.row_bytes)};
+        const std::size_t rows{std::min({band, item.size - item.done,
+                                         max_bytes / item.row_bytes})};
+        if(rows == 0) return 0;
+
+        target.allocate_sub_2d(item.width, static_cast<GLsizei>(rows),
+                               item.data + item.done * item.row_bytes, 0,
+                               static_cast<GLint>(item.done), item.format, item.pixel_type,
+                               item.level);
+        item.done += rows;
+        return rows * item.row_bytes;
+      }
+
+      const std::size_t bytes{std::min({chunk_bytes_, item.size - item.done, max_bytes})};
+      if(item.allocated && bytes == 0) return 0;
+
+      const GLsizei size{static_cast<GLsizei>(item.size)};
+      const GLvoid *data{item.data + item.done};
+      const GLintptr offset{static_cast<GLintptr>(item.done)};
+
+      switch(item.type){
+        case kind::array:{
+          buffer &target{*static_cast<buffer*>(item.target)};
+          glBindBuffer(GL_ARRAY_BUFFER, target.id_array());
+          if(!item.allocated) target.allocate_array(nullptr, size, item.usage);
+          else target.allocate_section_array(data, static_cast<GLsizei>(bytes), offset);
+        }
+        break;
+        case kind::element:{
+          // the element binding belongs to the vertex array object
+          buffer &target{*static_cast<buffer*>(item.target)};
+          glBindVertexArray(target.id_vertex());
+          glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, target.id_element());
+          if(!item.allocated) target.allocate_element(nullptr, size, item.usage);
+          else target.allocate_section_element(data, static_cast<GLsizei>(bytes), offset);
+        }
+        break;
+        default:{
+          uniform_buffer &target{*static_cast<uniform_buffer*>(item.target)};
+          target.bind();
+          if(!item.allocated) target.allocate(nullptr, size, item.usage);
+          else target.allocate_section(data, static_cast<GLsizeiptr>(bytes), offset);
+        }
+        break;
+      }
+
+      if(!item.allocated){
+        item.allocated = true;
+        return 0;
+      }
+      item.done += bytes;
+      return bytes;
+    }
+  } // namespace: gl
+} // namespace: ramrod
@@ -0,0 +1,334 @@
+#include "ramrod/gl/video_sink.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "ramrod/gl/frame_buffer.h"
+#include "ramrod/gl/pixel_conversion.h"
+
+namespace ramrod {
+  namespace gl {
+    video_sink::video_sink(const std::size_t frames, const std::size_t threads) :
+      readbacks_(frames == 0 ? 1 : frames),
+      frames_(frames == 0 ? 1 : frames),
+      order_(),
+      jobs_(),
+      thread_count_(threads),
+      worker_(),
+      helpers_(),
+      mutex_(),
+      work_(),
+      progress_(),
+      bands_(),
+      bands_done_(),
+      band_frame_(nullptr),
+      band_generation_(0),
+      bands_left_(0),
+      stream_(nullptr),
+      owns_stream_(false),
+      failed_(false),
+      stopping_(false),
+      container_(video::container::y4m),
+      layout_(video::layout::i420),
+      width_(0),
+      height_(0),
+      statistics_()
+    {
+      if(thread_count_ == 0)
+        thread_count_ = std::min<std::size_t>(4, std::max(1u, std::thread::hardware_concurrency()));
+
+      for(frame &item : frames_){
+        item.pixels = nullptr;
+        item.row_bytes = 0;
+        item.ticket = 0;
+        item.busy = false;
+        item.converted = false;
+        item.written = false;
+      }
+    }
+
+    video_sink::~video_sink(){
+      close();
+    }
+
+    bool video_sink::capture(){
+      if(!is_open()) return false;
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      frame *item{acquire(lock)};
+      if(item == nullptr) return false;
+      return submit(*item, readbacks_.read(0, 0, width_, height_, GL_BGRA, GL_UNSIGNED_BYTE));
+    }
+
+    bool video_sink::capture(frame_buffer &source, const GLenum attachment){
+      if(!is_open() || !source.is_created()) return false;
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      frame *item{acquire(lock)};
+      if(item == nullptr) return false;
+      return submit(*item, readbacks_.read(source, attachment, 0, 0, width_, height_,
+                                           GL_BGRA, GL_UNSIGNED_BYTE));
+    }
+
+    bool video_sink::close(){
+      if(!is_open()) return false;
+
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        update();
+        while(!order_.empty()){
+          frame &oldest{frames_[order_.front()]};
+          if(oldest.ticket != 0 && oldest.pixels == nullptr)
+            map(oldest, true);
+          else
+            progress_.wait(lock);
+          update();
+        }
+        stopping_ = true;
+        work_.notify_all();
+        bands_.notify_all();
+      }
+      worker_.join();
+      for(std::thread &thread : helpers_)
+        thread.join();
+      helpers_.clear();
+      band_frame_ = nullptr;
+      bands_left_ = 0;
+
+      bool success{!failed_ && std::fflush(stream_) == 0};
+      if(owns_stream_ && std::fclose(stream_) != 0) success = false;
+      stream_ = nullptr;
+      owns_stream_ = false;
+      failed_ = false;
+      stopping_ = false;
+      return success;
+    }
+
+    bool video_sink::is_open() const{
+      return stream_ != nullptr;
+    }
+
+    bool video_sink::open(const std::string &path, const GLsizei width, const GLsizei height,
+                          const unsigned int numerator, const unsigned int denominator,
+                          const video::container container, const video::layout layout){
+      if(is_open() || path.empty()) return false;
+
+      std::FILE *stream{std::fopen(path.c_str(), "wb")};
+      if(stream == nullptr) return false;
+      if(!open(stream, width, height, numerator, denominator, container, layout)){
+        std::fclose(stream);
+        return false;
+      }
+      owns_stream_ = true;
+      return true;
+    }
+
+    bool video_sink::open(std::FILE *stream, const GLsizei width, const GLsizei height,
+                          const unsigned int numerator, const unsigned int denominator,
+                          const video::container container, const video::layout layout){
+      if(is_open() || stream == nullptr || width <= 0 || height <= 0
+         || numerator == 0 || denominator == 0) return false;
+      // YUV4MPEG2 only has planar layouts
+      if(container == video::container::y4m && layout != video::layout::i420) return false;
+
+      if(container == video::container::y4m
+         && std::fprintf(stream, "YUV4MPEG2 W%d H%d F%u:%u Ip A1:1 C420jpeg XCOLORRANGE=LIMITED\n",
+                         width, height, numerator, denominator) < 0)
+        return false;
+
+      const std::size_t luma{static_cast<std::size_t>(width) * static_cast<std::size_t>(height)};
+      const std::size_t chroma{(static_cast<std::size_t>(width) + 1) / 2
+                               * ((static_cast<std::size_t>(height) + 1) / 2)};
+      for(frame &item : frames_)
+        item.planes.resize(luma + chroma * 2);
+
+      stream_ = stream;
+      owns_stream_ = false;
+      container_ = container;
+      layout_ = layout;
+      width_ = width;
+      height_ = height;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        statistics_ = video_statistics();
+      }
+
+      // the bands of a previous open() were already converted, the helpers wait for
+      // the next generation
+      for(std::size_t band = 1; band < thread_count_; ++band)
+        helpers_.emplace_back(&video_sink::helper, this, band, band_generation_);
+      worker_ = std::thread(&video_sink::worker, this);
+      return true;
+    }
+
+    video_statistics video_sink::statistics() const{
+      std::lock_guard<std::mutex> lock(mutex_);
+      return statistics_;
+    }
+
+    video_sink::frame *video_sink::acquire(std::unique_lock<std::mutex> &lock){
+      bool stalled{false};
+      for(;;){
+        update();
+        if(failed_) return nullptr;
+
+        for(frame &item : frames_)
+          if(!item.busy) return &item;
+
+        if(!stalled){
+          ++statistics_.stalls;
+          stalled = true;
+        }
+        frame &oldest{frames_[order_.front()]};
+        if(oldest.ticket != 0 && oldest.pixels == nullptr)
+          map(oldest, true);
+        else
+          progress_.wait(lock);
+      }
+    }
+
+    void video_sink::convert_band(frame &item, const std::size_t band){
+      const std::size_t width{static_cast<std::size_t>(width_)};
+      const std::size_t height{static_cast<std::size_t>(height_)};
+      // bands hold whole pairs of rows so they share no chroma row
+      const std::size_t pairs{(height + 1) / 2};
+      const std::size_t first{pairs * band / thread_count_ * 2};
+      const std::size_t last{std::min(height, pairs * (band + 1) / thread_count_ * 2)};
+      if(first >= last) return;
+
+      const std::size_t chroma_width{(width + 1) / 2};
+      const std::size_t chroma_height{(height + 1) / 2};
+      std::uint8_t *y{item.planes.data() + first * width};
+      std::uint8_t *chroma{item.planes.data() + width * height};
+      // the rows of OpenGL go from the bottom, the last rows of the image come first
+      const std::uint8_t *source{item.pixels + (height - last) * item.row_bytes};
+
+      if(layout_ == video::layout::nv12){
+        pixel::bgra_to_nv12(source, item.row_bytes, width, last - first, y,
+                            chroma + first / 2 * chroma_width * 2, true);
+      }else{
+        pixel::bgra_to_i420(source, item.row_bytes, width, last - first, y,
+                            chroma + first / 2 * chroma_width,
+                            chroma + (chroma_height + first / 2) * chroma_width, true);
+      }
+    }
+
+    void video_sink::helper(const std::size_t band, std::uint64_t generation){
+      std::unique_lock<std::mutex> lock(mutex_);
+      for(;;){
+        bands_.wait(lock, [&]{ return stopping_ || band_generation_ != generation; });
+        if(band_generation_ == generation) return;
+        generation = band_generation_;
+
+        frame *item{band_frame_};
+        lock.unlock();
+        convert_band(*item, band);
+        lock.lock();
+        if(--bands_left_ == 0) bands_done_.notify_one();
+      }
+    }
+
+    void video_sink::map(frame &item, const bool wait){
+      item.pixels = static_cast<const std::uint8_t*>(readbacks_.map(item.ticket, wait));
+      if(item.pixels == nullptr){
+        if(!wait) return;
+        // the frame is lost and the stream would be missing it
+        failed_ = true;
+        readbacks_.cancel(item.ticket);
+        item.ticket = 0;
+        item.converted = item.written = true;
+        return;
+      }
+      jobs_.push_back(static_cast<std::size_t>(&item - frames_.data()));
+      work_.notify_one();
+    }
+
+    bool video_sink::submit(frame &item, const std::uint64_t ticket){
+      if(ticket == 0) return false;
+
+      const std::size_t width_bytes{static_cast<std::size_t>(width_) * 4};
+      item.row_bytes = height_ > 1 ? (readbacks_.size(ticket) - width_bytes)
+                                     / static_cast<std::size_t>(height_ - 1) : width_bytes;
+      item.pixels = nullptr;
+      item.ticket = ticket;
+      item.busy = true;
+      item.converted = false;
+      item.written = false;
+      order_.push_back(static_cast<std::size_t>(&item - frames_.data()));
+      ++statistics_.captured;
+      return true;
+    }
+
+    void video_sink::update(){
+      // frames are mapped in capture order so the worker writes them in order
+      bool reading{false};
+      for(const std::size_t index : order_){
+        frame &item{frames_[index]};
+        if(item.ticket == 0) continue;
+
+        if(item.pixels == nullptr){
+          if(!reading && readbacks_.is_ready(item.ticket)) map(item, false);
+          reading = reading || item.pixels == nullptr;
+        }else if(item.converted){
+          readbacks_.release(item.ticket);
+          item.ticket = 0;
+          item.pixels = nullptr;
+        }
+      }
+
+      while(!order_.empty()){
+        frame &oldest{frames_[order_.front()]};
+        if(oldest.ticket != 0 || !oldest.written) break;
+        oldest.busy = false;
+        order_.pop_front();
+      }
+    }
+
+    void video_sink::worker(){
+      std::unique_lock<std::mutex> lock(mutex_);
+      for(;;){
+        work_.wait(lock, [this]{ return stopping_ || !jobs_.empty(); });
+        if(jobs_.empty()) return;
+
+        frame &item{frames_[jobs_.front()]};
+        jobs_.pop_front();
+        const bool skip{failed_};
+
+        if(!skip){
+          const auto start{std::chrono::steady_clock::now()};
+          band_frame_ = &item;
+          bands_left_ = helpers_.size();
+          ++band_generation_;
+          bands_.notify_all();
+          lock.unlock();
+          convert_band(item, 0);
+          lock.lock();
+          bands_done_.wait(lock, [this]{ return bands_left_ == 0; });
+          statistics_.convert_milliseconds = std::chrono::duration<double, std::milli>(
+                                               std::chrono::steady_clock::now() - start).count();
+        }
+        item.converted = true;
+        progress_.notify_all();
+
+        if(!skip){
+          lock.unlock();
+          const bool written{write(item)};
+          lock.lock();
+          if(written){
+            ++statistics_.written;
+            statistics_.total_bytes += item.planes.size();
+          }else{
+            failed_ = true;
+          }
+        }
+        item.written = true;
+        progress_.notify_all();
+      }
+    }
+
+    bool video_sink::write(const frame &item){
+      if(container_ == video::container::y4m && std::fputs("FRAME\n", stream_) < 0) return false;
+      return std::fwrite(item.planes.data(), 1, item.planes.size(), stream_) == item.planes.size();
+    }
+  } // namespace: gl
+} // namespace: ramrod
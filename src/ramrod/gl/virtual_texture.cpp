@@ -0,0 +1,553 @@
+#include "ramrod/gl/virtual_texture.h"
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+
+namespace ramrod {
+  namespace gl {
+    namespace {
+      // the indirection texture stores page coordinates in 8 bits
+      constexpr GLsizei maximum_pages_per_side{256};
+
+      std::uint64_t page_key(const std::uint32_t level, const std::uint32_t x,
+                             const std::uint32_t y){
+        return (static_cast<std::uint64_t>(level) << 48)
+               | (static_cast<std::uint64_t>(y) << 24) | x;
+      }
+
+      std::uint32_t key_level(const std::uint64_t key){
+        return static_cast<std::uint32_t>(key >> 48);
+      }
+
+      std::uint32_t key_x(const std::uint64_t key){
+        return static_cast<std::uint32_t>(key & 0xFFFFFF);
+      }
+
+      std::uint32_t key_y(const std::uint64_t key){
+        return static_cast<std::uint32_t>((key >> 24) & 0xFFFFFF);
+      }
+
+      std::uint32_t entry_level(const std::uint32_t entry){
+        return (entry >> 16) & 0xFF;
+      }
+
+      bool entry_valid(const std::uint32_t entry){
+        return (entry >> 24) != 0;
+      }
+
+      constexpr GLenum unpack_parameters[4]{GL_UNPACK_ALIGNMENT, GL_UNPACK_ROW_LENGTH,
+                                            GL_UNPACK_SKIP_ROWS, GL_UNPACK_SKIP_PIXELS};
+
+      // Saves the caller's unpack parameters and sets tightly packed rows
+      void save_unpack(GLint (&previous)[4], const GLint alignment){
+        for(std::size_t i = 0; i < 4; ++i)
+          glGetIntegerv(unpack_parameters[i], &previous[i]);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+      }
+
+      void restore_unpack(const GLint (&previous)[4]){
+        for(std::size_t i = 0; i < 4; ++i)
+          glPixelStorei(unpack_parameters[i], previous[i]);
+      }
+    } // namespace
+
+    virtual_texture::virtual_texture(const GLsizei pages_per_side, const GLsizei feedback_width,
+                                     const GLsizei feedback_height) :
+      pyramid_(),
+      physical_(false, 0, false),
+      indirection_(false, 0, false),
+      feedback_color_(false, 0, false),
+      feedback_(),
+      readbacks_(),
+      write_index_(0),
+      read_index_(0),
+      pages_(),
+      recent_(),
+      free_(),
+      resident_(),
+      pending_(),
+      entries_(),
+      entry_width_(),
+      entry_height_(),
+      dirty_(),
+      frame_(0),
+      pages_per_side_(std::clamp<GLsizei>(pages_per_side, 1, maximum_pages_per_side)),
+      feedback_width_(std::max<GLsizei>(1, feedback_width)),
+      feedback_height_(std::max<GLsizei>(1, feedback_height)),
+      previous_frame_buffer_(0),
+      previous_viewport_{0, 0, 0, 0},
+      in_feedback_(false),
+      statistics_()
+    {}
+
+    virtual_texture::~virtual_texture(){
+      close();
+    }
+
+    bool virtual_texture::begin_feedback(){
+      if(!pyramid_.is_open() || in_feedback_) return false;
+
+      glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_frame_buffer_);
+      glGetIntegerv(GL_VIEWPORT, previous_viewport_);
+
+      feedback_.bind();
+      glViewport(0, 0, feedback_width_, feedback_height_);
+      // alpha 1.0 marks the pixels that do not request any tile
+      const GLfloat empty[4]{0.0f, 0.0f, 0.0f, 1.0f};
+      const GLfloat far_depth{1.0f};
+      glClearBufferfv(GL_COLOR, 0, empty);
+      glClearBufferfv(GL_DEPTH, 0, &far_depth);
+
+      in_feedback_ = true;
+      return true;
+    }
+
+    bool virtual_texture::bind(const GLuint physical_unit, const GLuint indirection_unit){
+      if(!pyramid_.is_open()) return false;
+
+      physical_.active_texture(physical_unit);
+      physical_.bind();
+      indirection_.active_texture(indirection_unit);
+      indirection_.bind();
+      return true;
+    }
+
+    bool virtual_texture::close(){
+      if(!pyramid_.is_open()) return false;
+
+      for(readback &item : readbacks_){
+        item.fence.delete_sync();
+        item.buffer.delete_buffer();
+      }
+      write_index_ = read_index_ = 0;
+
+      physical_.delete_texture();
+      indirection_.delete_texture();
+      feedback_color_.delete_texture();
+      feedback_.delete_frame();
+
+      pages_.clear();
+      recent_.clear();
+      free_.clear();
+      resident_.clear();
+      pending_.clear();
+      entries_.clear();
+      entry_width_.clear();
+      entry_height_.clear();
+      dirty_.clear();
+      in_feedback_ = false;
+      statistics_ = virtual_texture_statistics();
+
+      return pyramid_.close();
+    }
+
+    bool virtual_texture::end_feedback(){
+      if(!in_feedback_) return false;
+      in_feedback_ = false;
+
+      readback &target{readbacks_[write_index_]};
+      if(target.fence.is_created()){
+        ++statistics_.dropped_feedback;
+      }else{
+        target.buffer.read_buffer(GL_COLOR_ATTACHMENT0);
+        target.buffer.bind();
+        target.buffer.read_pixels(0, 0, feedback_width_, feedback_height_,
+                                  GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        target.buffer.release();
+        target.fence.insert();
+        write_index_ = (write_index_ + 1) % readback_count_;
+      }
+
+      glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_frame_buffer_));
+      glViewport(previous_viewport_[0], previous_viewport_[1],
+                 previous_viewport_[2], previous_viewport_[3]);
+      return true;
+    }
+
+    texture &virtual_texture::indirection(){
+      return indirection_;
+    }
+
+    bool virtual_texture::is_resident(const std::uint32_t level, const std::uint32_t x,
+                                      const std::uint32_t y) const {
+      return resident_.count(page_key(level, x, y)) > 0;
+    }
+
+    bool virtual_texture::open(const std::string &path){
+      close();
+      if(!pyramid_.open(path)) return false;
+
+      const tile_pyramid_header &header{pyramid_.header()};
+      const GLsizei size{page_size()};
+      const std::uint32_t coarsest{header.levels - 1};
+      const std::size_t pinned{static_cast<std::size_t>(pyramid_.tiles_x(coarsest))
+                               * pyramid_.tiles_y(coarsest)};
+
+      GLint maximum_size{0};
+      glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maximum_size);
+      const GLsizei pages_per_side{std::min(pages_per_side_, maximum_size / size)};
+
+      // compressed tiles do not have a pixel format
+      if(header.format == 0 || pages_per_side <= 0
+         || pinned >= static_cast<std::size_t>(pages_per_side) * pages_per_side){
+        pyramid_.close();
+        return false;
+      }
+
+      // physical page cache
+      physical_.generate();
+      physical_.bind();
+      physical_.allocate(pages_per_side * size, pages_per_side * size, nullptr, header.format,
+                         header.type, static_cast<GLint>(header.internal_format));
+      physical_.parameter(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_LINEAR, GL_LINEAR);
+
+      // the base level is big enough for every level to fit in its mipmap
+      GLsizei base_width{1}, base_height{1};
+      for(std::uint32_t level = 0; level < header.levels; ++level){
+        base_width = std::max<GLsizei>(base_width, pyramid_.tiles_x(level) << level);
+        base_height = std::max<GLsizei>(base_height, pyramid_.tiles_y(level) << level);
+      }
+
+      indirection_.generate();
+      indirection_.bind();
+      entries_.resize(header.levels);
+      entry_width_.resize(header.levels);
+      entry_height_.resize(header.levels);
+      dirty_.resize(header.levels * 4);
+      for(std::uint32_t level = 0; level < header.levels; ++level){
+        entry_width_[level] = std::max<GLsizei>(1, base_width >> level);
+        entry_height_[level] = std::max<GLsizei>(1, base_height >> level);
+        entries_[level].assign(static_cast<std::size_t>(entry_width_[level])
+                               * entry_height_[level], 0);
+        indirection_.allocate(entry_width_[level], entry_height_[level], nullptr,
+                              GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA8, static_cast<GLint>(level));
+        dirty_[level * 4] = dirty_[level * 4 + 1] = INT_MAX;
+        dirty_[level * 4 + 2] = dirty_[level * 4 + 3] = -1;
+      }
+      indirection_.parameter(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE,
+                             GL_NEAREST_MIPMAP_NEAREST, GL_NEAREST);
+      indirection_.parameter(static_cast<GLenum>(GL_TEXTURE_BASE_LEVEL), 0);
+      indirection_.parameter(static_cast<GLenum>(GL_TEXTURE_MAX_LEVEL),
+                             static_cast<GLint>(coarsest));
+
+      // feedback target
+      feedback_color_.generate();
+      feedback_color_.bind();
+      feedback_color_.allocate(feedback_width_, feedback_height_);
+      feedback_color_.parameter(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_NEAREST, GL_NEAREST);
+
+      feedback_.generate_frame(true);
+      feedback_.bind();
+      feedback_.attach_2D(feedback_color_.id());
+      feedback_.bind_render();
+      feedback_.render_storage(feedback_width_, feedback_height_);
+      feedback_.attach_render();
+      const bool complete{feedback_.status() == GL_FRAMEBUFFER_COMPLETE};
+      feedback_.release_render();
+      feedback_.release();
+
+      for(readback &item : readbacks_){
+        item.buffer.generate();
+        item.buffer.bind();
+        item.buffer.allocate_data(nullptr, feedback_width_ * feedback_height_ * 4);
+        item.buffer.release();
+      }
+
+      pages_.assign(static_cast<std::size_t>(pages_per_side) * pages_per_side,
+                    page{0, 0, recent_.end()});
+      free_.resize(pages_.size());
+      // the first page ends at the back so it is used first
+      for(std::size_t index = 0; index < free_.size(); ++index)
+        free_[index] = free_.size() - 1 - index;
+      pages_per_side_ = pages_per_side;
+      frame_ = 1;
+
+      GLint unpack[4];
+      save_unpack(unpack, 1);
+
+      bool pinned_loaded{complete};
+      for(std::uint32_t y = 0; pinned_loaded && y < pyramid_.tiles_y(coarsest); ++y)
+        for(std::uint32_t x = 0; pinned_loaded && x < pyramid_.tiles_x(coarsest); ++x)
+          pinned_loaded = pyramid_.tile(coarsest, x, y) != nullptr
+                          && upload(page_key(coarsest, x, y));
+      restore_unpack(unpack);
+
+      if(!pinned_loaded){
+        close();
+        return false;
+      }
+
+      upload_indirection();
+      indirection_.release();
+      return true;
+    }
+
+    GLsizei virtual_texture::page_size() const {
+      if(!pyramid_.is_open()) return 0;
+      return static_cast<GLsizei>(pyramid_.header().tile_size + 2 * pyramid_.header().border);
+    }
+
+    texture &virtual_texture::physical(){
+      return physical_;
+    }
+
+    const tile_pyramid &virtual_texture::pyramid() const {
+      return pyramid_;
+    }
+
+    bool virtual_texture::request(const std::uint32_t level, const std::uint32_t x,
+                                  const std::uint32_t y){
+      if(!pyramid_.is_open()) return false;
+
+      // the coarser tiles are shown until this one is loaded, or instead of it if it
+      // is missing, so they are requested even then
+      for(std::uint32_t parent = pyramid_.header().levels; parent-- > level;){
+        const std::uint32_t shift{parent - level};
+        if(pyramid_.tile(parent, x >> shift, y >> shift) != nullptr)
+          want(parent, x >> shift, y >> shift);
+      }
+      return pyramid_.tile(level, x, y) != nullptr;
+    }
+
+    const virtual_texture_statistics &virtual_texture::statistics() const {
+      return statistics_;
+    }
+
+    std::size_t virtual_texture::update(const std::size_t max_uploads){
+      if(!pyramid_.is_open() || in_feedback_) return 0;
+
+      ++frame_;
+      collect_feedback();
+
+      // coarser levels have bigger keys
+      std::sort(pending_.begin(), pending_.end(), std::greater<std::uint64_t>());
+      pending_.erase(std::unique(pending_.begin(), pending_.end()), pending_.end());
+
+      GLint unpack[4];
+      save_unpack(unpack, 1);
+
+      std::size_t uploaded{0}, index{0};
+      while(index < pending_.size() && uploaded < max_uploads){
+        if(resident_.count(pending_[index]) > 0){
+          ++index;
+          continue;
+        }
+        // every page is visible in this frame
+        if(!upload(pending_[index])) break;
+        ++uploaded;
+        ++index;
+      }
+      pending_.erase(pending_.begin(), pending_.begin() + static_cast<std::ptrdiff_t>(index));
+
+      restore_unpack(unpack);
+      upload_indirection();
+
+      // the next pages are read from disk while this frame is drawn
+      for(std::size_t next = 0; next < std::min(max_uploads, pending_.size()); ++next)
+        pyramid_.prefetch(key_level(pending_[next]), key_x(pending_[next]),
+                          key_y(pending_[next]));
+
+      statistics_.uploads += uploaded;
+      statistics_.pending = pending_.size();
+      statistics_.resident_pages = resident_.size();
+      return uploaded;
+    }
+
+    bool virtual_texture::collect_feedback(){
+      bool collected{false};
+      const GLsizeiptr size{static_cast<GLsizeiptr>(feedback_width_) * feedback_height_ * 4};
+
+      while(readbacks_[read_index_].fence.is_created()){
+        readback &source{readbacks_[read_index_]};
+        if(source.fence.wait(0) != fence::status::signaled) break;
+        source.fence.delete_sync();
+
+        source.buffer.bind();
+        const void *pixels{source.buffer.map_range(0, size, GL_MAP_READ_BIT)};
+        if(pixels != nullptr){
+          parse_feedback(static_cast<const std::uint32_t*>(pixels),
+                         static_cast<std::size_t>(feedback_width_) * feedback_height_);
+          collected = true;
+        }
+        source.buffer.unmap();
+        source.buffer.release();
+        read_index_ = (read_index_ + 1) % readback_count_;
+      }
+      return collected;
+    }
+
+    void virtual_texture::map_page(const std::uint32_t level, const std::uint32_t x,
+                                   const std::uint32_t y, const std::uint32_t value){
+      for(std::uint32_t child = 0; child <= level; ++child){
+        const std::uint32_t shift{level - child};
+        const GLint x_0{static_cast<GLint>(x << shift)}, y_0{static_cast<GLint>(y << shift)};
+        const GLint x_1{std::min(static_cast<GLint>((x + 1) << shift),
+                                 static_cast<GLint>(pyramid_.tiles_x(child)))};
+        const GLint y_1{std::min(static_cast<GLint>((y + 1) << shift),
+                                 static_cast<GLint>(pyramid_.tiles_y(child)))};
+        if(x_0 >= x_1 || y_0 >= y_1) continue;
+
+        std::vector<std::uint32_t> &entries{entries_[child]};
+        for(GLint row = y_0; row < y_1; ++row){
+          std::uint32_t *entry{&entries[static_cast<std::size_t>(row) * entry_width_[child]]};
+          // finer pages already mapped keep their texels
+          for(GLint column = x_0; column < x_1; ++column)
+            if(!entry_valid(entry[column]) || entry_level(entry[column]) >= level)
+              entry[column] = value;
+        }
+        mark_dirty(child, x_0, y_0, x_1 - 1, y_1 - 1);
+      }
+    }
+
+    void virtual_texture::mark_dirty(const std::uint32_t level, const GLint x_0, const GLint y_0,
+                                     const GLint x_1, const GLint y_1){
+      GLint *dirty{&dirty_[level * 4]};
+      dirty[0] = std::min(dirty[0], x_0);
+      dirty[1] = std::min(dirty[1], y_0);
+      dirty[2] = std::max(dirty[2], x_1);
+      dirty[3] = std::max(dirty[3], y_1);
+    }
+
+    void virtual_texture::parse_feedback(const std::uint32_t *pixels, const std::size_t count){
+      // a newer feedback replaces whatever was still pending
+      pending_.clear();
+      statistics_.requested = 0;
+
+      const std::uint32_t levels{pyramid_.header().levels};
+      std::uint32_t previous{0xFFFFFFFF};
+      std::vector<std::uint64_t> requested;
+
+      for(std::size_t index = 0; index < count; ++index){
+        const std::uint32_t value{pixels[index]};
+        // neighbouring pixels usually request the same tile
+        if(value == previous) continue;
+        previous = value;
+
+        const std::uint32_t level{value >> 24};
+        if(level >= levels) continue;
+        const std::uint32_t x{(value & 0xFF) | (((value >> 16) & 0x0F) << 8)};
+        const std::uint32_t y{((value >> 8) & 0xFF) | (((value >> 20) & 0x0F) << 8)};
+        requested.push_back(page_key(level, x, y));
+      }
+
+      std::sort(requested.begin(), requested.end());
+      requested.erase(std::unique(requested.begin(), requested.end()), requested.end());
+      statistics_.requested = requested.size();
+
+      for(const std::uint64_t key : requested)
+        request(key_level(key), key_x(key), key_y(key));
+    }
+
+    void virtual_texture::unmap_page(const std::uint32_t level, const std::uint32_t x,
+                                     const std::uint32_t y){
+      // texels fall back to whatever covers the parent tile
+      const std::uint32_t parent{level + 1 < pyramid_.header().levels ?
+                                 entries_[level + 1][static_cast<std::size_t>(y >> 1)
+                                                     * entry_width_[level + 1] + (x >> 1)] : 0};
+
+      for(std::uint32_t child = 0; child <= level; ++child){
+        const std::uint32_t shift{level - child};
+        const GLint x_0{static_cast<GLint>(x << shift)}, y_0{static_cast<GLint>(y << shift)};
+        const GLint x_1{std::min(static_cast<GLint>((x + 1) << shift),
+                                 static_cast<GLint>(pyramid_.tiles_x(child)))};
+        const GLint y_1{std::min(static_cast<GLint>((y + 1) << shift),
+                                 static_cast<GLint>(pyramid_.tiles_y(child)))};
+        if(x_0 >= x_1 || y_0 >= y_1) continue;
+
+        std::vector<std::uint32_t> &entries{entries_[child]};
+        for(GLint row = y_0; row < y_1; ++row){
+          std::uint32_t *entry{&entries[static_cast<std::size_t>(row) * entry_width_[child]]};
+          for(GLint column = x_0; column < x_1; ++column)
+            if(entry_valid(entry[column]) && entry_level(entry[column]) == level)
+              entry[column] = parent;
+        }
+        mark_dirty(child, x_0, y_0, x_1 - 1, y_1 - 1);
+      }
+    }
+
+    bool virtual_texture::upload(const std::uint64_t key){
+      const std::uint32_t level{key_level(key)}, x{key_x(key)}, y{key_y(key)};
+      const bool pinned{level + 1 == pyramid_.header().levels};
+      const void *data{pyramid_.tile(level, x, y)};
+      // a missing tile keeps showing its parent
+      if(data == nullptr) return true;
+
+      std::size_t index;
+      if(!free_.empty()){
+        index = free_.back();
+        free_.pop_back();
+      }else{
+        if(recent_.empty()) return false;
+        index = recent_.back();
+        page &victim{pages_[index]};
+        if(victim.frame == frame_) return false;
+
+        unmap_page(key_level(victim.key), key_x(victim.key), key_y(victim.key));
+        resident_.erase(victim.key);
+        recent_.pop_back();
+        ++statistics_.evictions;
+      }
+
+      const GLsizei size{page_size()};
+      const GLint page_x{static_cast<GLint>(index % static_cast<std::size_t>(pages_per_side_))};
+      const GLint page_y{static_cast<GLint>(index / static_cast<std::size_t>(pages_per_side_))};
+      const tile_pyramid_header &header{pyramid_.header()};
+
+      physical_.bind();
+      physical_.allocate_sub_2d(size, size, data, page_x * size, page_y * size,
+                                header.format, header.type);
+
+      page &target{pages_[index]};
+      target.key = key;
+      target.frame = frame_;
+      target.position = pinned ? recent_.end() : recent_.insert(recent_.begin(), index);
+      resident_[key] = index;
+
+      map_page(level, x, y, static_cast<std::uint32_t>(page_x) | (page_y << 8)
+                            | (level << 16) | 0xFF000000u);
+      return true;
+    }
+
+    void virtual_texture::upload_indirection(){
+      GLint unpack[4];
+      save_unpack(unpack, 4);
+      indirection_.bind();
+
+      for(std::uint32_t level = 0; level < entries_.size(); ++level){
+        GLint *dirty{&dirty_[level * 4]};
+        if(dirty[2] < dirty[0] || dirty[3] < dirty[1]) continue;
+
+        indirection_.pixel_store_i(GL_UNPACK_ROW_LENGTH, entry_width_[level]);
+        indirection_.allocate_sub_2d(dirty[2] - dirty[0] + 1, dirty[3] - dirty[1] + 1,
+                                     &entries_[level][static_cast<std::size_t>(dirty[1])
+                                                      * entry_width_[level] + dirty[0]],
+                                     dirty[0], dirty[1], GL_RGBA, GL_UNSIGNED_BYTE,
+                                     static_cast<GLint>(level));
+        dirty[0] = dirty[1] = INT_MAX;
+        dirty[2] = dirty[3] = -1;
+      }
+
+      restore_unpack(unpack);
+    }
+
+    bool virtual_texture::want(const std::uint32_t level, const std::uint32_t x,
+                               const std::uint32_t y){
+      const std::uint64_t key{page_key(level, x, y)};
+      const auto found{resident_.find(key)};
+      if(found == resident_.end()){
+        pending_.push_back(key);
+        return false;
+      }
+
+      page &item{pages_[found->second]};
+      item.frame = frame_;
+      if(item.position != recent_.end())
+        recent_.splice(recent_.begin(), recent_, item.position);
+      return true;
+    }
+  } // namespace: gl
+} // namespace: ramrod
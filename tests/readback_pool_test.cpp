@@ -0,0 +1,105 @@
+#include "ramrod/gl/context.h"
+#include "ramrod/gl/readback_pool.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+  std::atomic<bool> counting{false};
+  std::atomic<std::size_t> allocations{0};
+
+  void *allocate(const std::size_t size){
+    if(counting) ++allocations;
+    if(void *memory{std::malloc(size > 0 ? size : 1)}) return memory;
+    throw std::bad_alloc();
+  }
+
+  // ctest marks the test as skipped
+  constexpr int skipped{77};
+  constexpr int width{256}, height{128};
+  constexpr int warm_up_frames{16}, frames{512};
+}
+
+// Every heap allocation of the process goes through these
+void *operator new(std::size_t size){ return allocate(size); }
+void *operator new[](std::size_t size){ return allocate(size); }
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+
+/**
+ * Reads, delivers and recycles frames with a readback_pool and checks that the steady
+ * state does not allocate.
+ */
+int main(){
+  using namespace ramrod::gl;
+
+  context headless;
+  if(!headless.create() || !headless.make_current()){
+    std::printf("No headless OpenGL context, skipping\n");
+    return skipped;
+  }
+
+  GLuint frame_buffer{0}, render_buffer{0};
+  glGenFramebuffers(1, &frame_buffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer);
+  glGenRenderbuffers(1, &render_buffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, render_buffer);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                            render_buffer);
+  if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE){
+    std::printf("Incomplete frame buffer\n");
+    return EXIT_FAILURE;
+  }
+
+  readback_pool *owner{nullptr};
+  // red channel of the clear color of every read, by ticket
+  std::uint8_t expected[64]{};
+  std::size_t delivered{0}, wrong_pixels{0};
+  readback_pool pool([&](const pooled_buffer &buffer){
+    if(buffer.data[0] != expected[buffer.ticket % 64]) ++wrong_pixels;
+    ++delivered;
+    owner->recycle(buffer);
+  }, 3);
+  owner = &pool;
+
+  if(!pool.allocate(4, readback_queue::required_size(width, height, GL_RGBA,
+                                                     GL_UNSIGNED_BYTE))){
+    std::printf("Buffers could not be allocated\n");
+    return EXIT_FAILURE;
+  }
+
+  std::size_t refused{0};
+  for(int frame = 0; frame < frames; ++frame){
+    if(frame == warm_up_frames) counting = true;
+
+    pool.update();
+    const std::uint8_t red{static_cast<std::uint8_t>(frame % 256)};
+    glClearColor(red / 255.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    const std::uint64_t ticket{pool.read(0, 0, width, height)};
+    if(ticket == 0) ++refused;
+    else expected[ticket % 64] = red;
+  }
+  pool.update(true);
+  counting = false;
+
+  glDeleteRenderbuffers(1, &render_buffer);
+  glDeleteFramebuffers(1, &frame_buffer);
+
+  const readback_pool_statistics statistics{pool.statistics()};
+  std::printf("%zu delivered, %zu refused, %zu allocations after %d warm up frames\n",
+              delivered, refused, allocations.load(), warm_up_frames);
+
+  if(allocations != 0 || wrong_pixels != 0 || delivered == 0
+     || delivered != statistics.recycled){
+    std::printf("FAILED: %zu allocations, %zu wrong frames\n",
+                allocations.load(), wrong_pixels);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}